@@ -0,0 +1,162 @@
+#ifndef IONET_CODEC_COMPILED_SCHEMA_H
+#define IONET_CODEC_COMPILED_SCHEMA_H
+
+#include "PacketDispatch.h"
+#include "../core/BitReader.h"
+#include "../core/Types.h"
+#include "../schema/Schema.h"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace ionet::codec {
+
+/// Precomputed read step for a single field
+struct FieldPlan {
+    const schema::Field* def = nullptr;
+    std::size_t index = 0;          // Position in Packet::fields
+    std::size_t offset = 0;         // Byte offset from start of frame
+    std::size_t width = 0;          // Bytes read from the frame
+    std::size_t count = 0;          // Elements of a numeric array (0 for scalars)
+    core::DataType type = core::DataType::UInt8;
+    core::ByteOrder byteOrder = core::ByteOrder::Native;
+    bool swap = false;              // Byte swap needed on this host
+    
+    // Bit-packed integers (bitWidth 0 for byte-aligned fields). offset and
+    // width then give the bytes the bits touch.
+    std::size_t bitOffset = 0;      // Bit position from start of frame, MSB-first
+    uint8_t bitWidth = 0;
+    
+    // Variable-length fields (width 0): index of the earlier field holding the length
+    std::optional<std::size_t> lengthIndex;
+
+    // Scaling slot (scale = 1, bias = 0 when the field is unscaled)
+    bool scaled = false;
+    double scale = 1.0;
+    double bias = 0.0;
+    
+    // The same scaling in integers, for scaled integer fields that have one
+    std::optional<schema::FixedScaling> fixed;
+    int64_t fixedMin = INT64_MIN;   // Raw values `fixed` maps without overflow
+    int64_t fixedMax = INT64_MAX;
+};
+
+/// Packet definition flattened into a fixed sequence of read steps
+class CompiledPacket {
+public:
+    CompiledPacket(
+        const schema::Packet& packet,
+        core::ByteOrder byteOrder,
+        const schema::PacketNames* names = nullptr
+    );
+
+    /// Source definition
+    const schema::Packet& packet() const { return *packet_; }
+    uint32_t id() const { return packet_->id; }
+
+    /// Names interned by the schema (nullptr if compiled without them)
+    const schema::PacketNames* names() const { return names_; }
+
+    /// Read steps in field order
+    const std::vector<FieldPlan>& fields() const { return fields_; }
+
+    /// Frame size in bytes (valid when isFixedSize())
+    std::size_t size() const { return size_; }
+
+    /// True if every field has a known offset and width
+    bool isFixedSize() const { return fixedSize_; }
+
+private:
+    const schema::Packet* packet_;
+    const schema::PacketNames* names_;
+    std::vector<FieldPlan> fields_;
+    std::size_t size_ = 0;
+    bool fixedSize_ = true;
+};
+
+/// Subset of a packet's fields to decode, resolved once up front
+class Projection {
+public:
+    Projection() = default;
+    
+    /// Select fields by index into Packet::fields (sorted, duplicates dropped)
+    Projection(const CompiledPacket& packet, std::vector<std::size_t> fieldIndices);
+
+    const CompiledPacket* packet() const { return packet_; }
+
+    /// Selected read steps, in field order
+    const std::vector<const FieldPlan*>& fields() const { return fields_; }
+
+    bool empty() const { return fields_.empty(); }
+
+private:
+    const CompiledPacket* packet_ = nullptr;
+    std::vector<const FieldPlan*> fields_;
+};
+
+/// Read a field's raw value at its precomputed offset.
+/// The frame must hold at least the packet's size() bytes.
+core::Value readValue(const FieldPlan& plan, const uint8_t* frame);
+
+/// Read a numeric, bitfield or bit-packed field without going through a
+/// Value; empty for strings, bytes and arrays
+core::Scalar readScalar(const FieldPlan& plan, const uint8_t* frame);
+
+/// Read a bit-packed field through `bits`, which spans the frame. Consecutive
+/// packed fields continue from the reader's window instead of reloading.
+core::Scalar readPacked(const FieldPlan& plan, core::BitReader& bits);
+
+/// Like readValue, but string and bytes fields come back as std::string_view
+/// and core::ByteView into `frame` instead of copies; they are valid only
+/// while the frame is
+core::Value borrowValue(const FieldPlan& plan, const uint8_t* frame);
+
+/// Copy `count` packed elements of a numeric type into `out` at their
+/// declared width, in host byte order, reusing its storage
+void readElements(
+    core::DataType type,
+    const uint8_t* src,
+    std::size_t count,
+    core::ByteOrder order,
+    core::ElementArray& out
+);
+
+/// Scale every element into `out`, reusing its storage
+void scaleElements(const core::ElementArray& elements, double scale, double offset, std::pmr::vector<double>& out);
+
+/// Widen elements into the matching array alternative of a Value
+core::Value widenElements(const core::ElementArray& elements);
+
+/// Apply a plan's scaling slot to a numeric value or array
+core::Value scaleValue(const FieldPlan& plan, const core::Value& raw);
+
+/// Decode plans for every packet of a schema, built once up front.
+/// The schema must outlive the compiled form. Packets added to the schema
+/// later are not covered until the plans are compiled again.
+class CompiledSchema {
+public:
+    explicit CompiledSchema(const schema::Schema& schema);
+
+    /// Find plan by packet ID
+    const CompiledPacket* find(uint32_t id) const {
+        uint32_t index = dispatch_.find(id);
+        return index != PacketDispatch::kNotFound ? &packets_[index] : nullptr;
+    }
+
+    /// All plans, in schema order
+    const std::vector<CompiledPacket>& packets() const { return packets_; }
+
+    const schema::Schema& schema() const { return schema_; }
+
+    /// ID lookup table used by find()
+    const PacketDispatch& dispatch() const { return dispatch_; }
+
+private:
+    const schema::Schema& schema_;
+    std::vector<CompiledPacket> packets_;
+    PacketDispatch dispatch_;
+};
+
+} // namespace ionet::codec
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef IONET_CODEC_DECODE_ERROR_H
+#define IONET_CODEC_DECODE_ERROR_H
+
+#include "DecodeStatus.h"
+#include "../schema/Packet.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace ionet::codec {
+
+/// Structured description of a decode failure.
+/// Filling one in never allocates; call message() to format it for humans.
+struct DecodeError {
+    static constexpr uint32_t kNoField = UINT32_MAX;
+
+    DecodeStatus code = DecodeStatus::Ok;
+    uint32_t packetId = 0;
+    uint32_t fieldIndex = kNoField;     // Index in Packet::fields, kNoField for packet-level errors
+    std::size_t byteOffset = 0;         // Where the failing field starts in the frame
+    std::size_t needed = 0;             // Truncated: bytes required; InvalidLength: declared bytes
+    std::size_t available = 0;          // Truncated: bytes left
+    double value = 0.0;                 // Constraint violations: offending value
+    double limit = 0.0;                 // Constraint violations: violated limit
+
+    /// Definition of the failing packet, used only to name things in message()
+    const schema::Packet* packet = nullptr;
+
+    bool ok() const { return code == DecodeStatus::Ok; }
+
+    /// Name of the failing field, empty for packet-level errors
+    std::string_view fieldName() const;
+
+    /// Format a human-readable message
+    std::string message() const;
+};
+
+/// Per-code error tally, for classifying failures without keeping them
+class DecodeErrorCounts {
+public:
+    void record(const DecodeError& error) { record(error.code); }
+    void record(DecodeStatus code) { ++counts_[static_cast<std::size_t>(code)]; }
+
+    uint64_t count(DecodeStatus code) const { return counts_[static_cast<std::size_t>(code)]; }
+
+    /// Failures of any kind (Ok is not counted)
+    uint64_t total() const;
+
+    void reset() { counts_.fill(0); }
+
+private:
+    std::array<uint64_t, kDecodeStatusCount> counts_{};
+};
+
+} // namespace ionet::codec
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef IONET_CODEC_DECODE_PIPELINE_H
+#define IONET_CODEC_DECODE_PIPELINE_H
+
+#include "Decoder.h"
+#include "DecodeError.h"
+#include "../core/FrameSlab.h"
+#include "../core/SpscQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace ionet::codec {
+
+/// Options for a DecodePipeline
+struct PipelineOptions {
+    /// Worker threads (0: one per hardware thread)
+    std::size_t workers = 0;
+
+    /// Frames each worker's queue can hold before submit() backs off
+    std::size_t queueCapacity = 1024;
+
+    /// Bytes of frame storage per worker; submit() also backs off while a
+    /// worker's share is full, and rejects larger frames
+    std::size_t laneBytes = 256 * 1024;
+};
+
+/// Pipeline counters, summed over workers
+struct PipelineStats {
+    uint64_t submitted = 0;
+    uint64_t decoded = 0;
+    uint64_t failed = 0;
+};
+
+/// Decodes frames on a pool of worker threads.
+///
+/// Frames are sharded by packet ID, so every frame of one packet type is
+/// decoded by the same worker and reaches the callback in submission order;
+/// frames of different types may be delivered concurrently and out of
+/// order. Each worker is fed through its own bounded lock-free SPSC queue,
+/// so submit() must always be called from the same (ingest) thread.
+///
+/// Frame bytes are copied once, into the worker's lane of a shared
+/// core::FrameSlab; only the FrameDescriptor travels through the queue,
+/// and the worker decodes the bytes in place and releases them after the
+/// callback. One lane per worker keeps the slab's single-writer,
+/// in-order-release contract.
+///
+/// Callbacks run on worker threads. The packet is reused for that worker's
+/// next frame, so copy anything that must outlive the call.
+class DecodePipeline {
+public:
+    using PacketCallback = std::function<void(const DecodedPacket&)>;
+    using ErrorCallback = std::function<void(const DecodeError&)>;
+
+    /// Start the workers. The decoder must outlive the pipeline.
+    DecodePipeline(
+        const Decoder& decoder,
+        PacketCallback onPacket,
+        PipelineOptions options = {}
+    );
+
+    /// Drains queued frames, then joins the workers
+    ~DecodePipeline();
+
+    DecodePipeline(const DecodePipeline&) = delete;
+    DecodePipeline& operator=(const DecodePipeline&) = delete;
+
+    /// Set before the first submit(); called on worker threads
+    void setErrorCallback(ErrorCallback onError) { onError_ = std::move(onError); }
+
+    /// Copy a frame into its worker's slab lane and queue it, waiting while
+    /// either is full. Returns false once the pipeline is stopped, or for a
+    /// frame larger than PipelineOptions::laneBytes.
+    bool submit(uint32_t packetId, std::span<const uint8_t> frame);
+
+    /// Like submit() but returns false instead of waiting when the lane or
+    /// queue is full
+    bool trySubmit(uint32_t packetId, std::span<const uint8_t> frame);
+
+    /// Wait until every submitted frame has been decoded and delivered
+    void flush();
+
+    /// Drain queued frames and join the workers; later submits fail.
+    /// Call from the submitting thread.
+    void stop();
+
+    std::size_t workerCount() const { return workers_.size(); }
+
+    PipelineStats stats() const;
+
+private:
+    struct Worker {
+        Worker(uint32_t lane, std::size_t capacity) : lane(lane), queue(capacity) {}
+
+        uint32_t lane;                              // This worker's slab lane
+        core::SpscQueue<core::FrameDescriptor> queue;   // Tagged with the packet ID
+        std::thread thread;
+        DecodedPacket packet;
+
+        // Written by the producer. `signal` is bumped after every push and on
+        // stop; an idle worker waits on it.
+        alignas(core::kCacheLine) std::atomic<uint64_t> signal{0};
+        std::atomic<uint64_t> submitted{0};
+
+        // Written by the worker
+        alignas(core::kCacheLine) std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> failed{0};
+    };
+
+    Worker& workerFor(uint32_t packetId) { return *workers_[packetId % workers_.size()]; }
+    bool push(Worker& worker, uint32_t packetId, std::span<const uint8_t> frame);
+    void run(Worker& worker);
+
+    const Decoder& decoder_;
+    PacketCallback onPacket_;
+    ErrorCallback onError_;
+    std::unique_ptr<core::FrameSlab> slab_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> stopping_{false};
+};
+
+} // namespace ionet::codec
+
+#endif
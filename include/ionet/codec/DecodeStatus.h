@@ -0,0 +1,42 @@
+#ifndef IONET_CODEC_DECODE_STATUS_H
+#define IONET_CODEC_DECODE_STATUS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ionet::codec {
+
+/// Outcome of decoding a packet or field.
+/// Cheap to return and compare; no message is built unless asked for.
+enum class DecodeStatus : uint8_t {
+    Ok,
+    UnknownPacket,      // No packet with the requested ID
+    Truncated,          // Frame ended before the field/packet did
+    MissingSize,        // String/bytes field declared without a size
+    UnsupportedType,    // Field type the decoder cannot read
+    BelowMinimum,       // Value violates constraints.min
+    AboveMaximum,       // Value violates constraints.max
+    InvalidLength       // Frame header or length field declares an impossible length
+};
+
+/// Number of DecodeStatus values
+constexpr std::size_t kDecodeStatusCount = static_cast<std::size_t>(DecodeStatus::InvalidLength) + 1;
+
+/// Short fixed description of a status
+constexpr const char* decodeStatusToString(DecodeStatus status) {
+    switch (status) {
+        case DecodeStatus::Ok: return "ok";
+        case DecodeStatus::UnknownPacket: return "unknown packet";
+        case DecodeStatus::Truncated: return "truncated";
+        case DecodeStatus::MissingSize: return "missing size";
+        case DecodeStatus::UnsupportedType: return "unsupported type";
+        case DecodeStatus::BelowMinimum: return "below minimum";
+        case DecodeStatus::AboveMaximum: return "above maximum";
+        case DecodeStatus::InvalidLength: return "invalid length";
+    }
+    return "unknown";
+}
+
+} // namespace ionet::codec
+
+#endif
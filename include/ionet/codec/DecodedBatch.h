@@ -0,0 +1,94 @@
+#ifndef IONET_CODEC_DECODED_BATCH_H
+#define IONET_CODEC_DECODED_BATCH_H
+
+#include "../core/Types.h"
+#include "../schema/Packet.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ionet::codec {
+
+/// One field's values across every row of a batch, stored contiguously.
+/// Only the vector matching the field type is filled. Numeric array fields
+/// store `count` elements per row, row after row.
+struct Column {
+    const schema::Field* def = nullptr;
+    core::DataType type = core::DataType::UInt8;
+
+    std::vector<int64_t> ints;      // Signed integers
+    std::vector<uint64_t> uints;    // Unsigned integers and bitfield masks
+    std::vector<double> reals;      // Floating point
+    std::vector<uint8_t> bytes;     // String/bytes payloads, width bytes per row
+    std::size_t width = 0;          // Payload bytes per row (string/bytes)
+    std::size_t count = 1;          // Elements per row (numeric arrays)
+
+    /// Scaled values, filled when the field is scaled and scaling is enabled
+    std::vector<double> scaled;
+    bool isScaled = false;
+
+    /// Scaled values as fixed-point mantissas in units of 10^fixedExponent,
+    /// filled for scaled integer fields when DecodeOptions::fixedPointScaling
+    /// is set and the scaling has a fixed-point form (Field::fixedScaling). A
+    /// value whose mantissa would overflow int64 holds 0 and invalidates
+    /// its row.
+    std::vector<int64_t> fixed;
+    int8_t fixedExponent = 0;
+    bool isFixed = false;
+
+    const std::string& name() const { return def->name; }
+
+    /// Value at row (and array element) as double (scaled if available),
+    /// nullopt for non-numeric
+    std::optional<double> number(std::size_t row, std::size_t element = 0) const;
+
+    /// Fixed-point scaled value at row (and array element), nullopt unless
+    /// the column is fixed-point
+    std::optional<schema::FixedPoint> fixedAt(std::size_t row, std::size_t element = 0) const;
+
+    /// Payload at row for string/bytes columns
+    std::string_view text(std::size_t row) const;
+};
+
+/// Many frames of one packet type decoded into columns (structure of arrays)
+class DecodedBatch {
+public:
+    DecodedBatch() = default;
+    DecodedBatch(uint32_t packetId, std::string packetName, std::size_t rows);
+
+    /// Packet identification
+    uint32_t id() const { return packetId_; }
+    const std::string& name() const { return packetName_; }
+
+    /// Number of frames in the batch (invalid rows included)
+    std::size_t rowCount() const { return valid_.size(); }
+
+    /// Column access
+    void addColumn(Column column);
+    std::size_t columnCount() const { return columns_.size(); }
+    const std::vector<Column>& columns() const { return columns_; }
+    const Column* column(const std::string& name) const;
+    const Column* column(schema::FieldHandle handle) const;
+
+    /// Row validity: a row is invalid when its frame was too short, failed
+    /// a constraint or overflowed a fixed-point column. A short row holds
+    /// zeros in every column, scaled and fixed included; a row that failed
+    /// a constraint keeps its decoded values; an overflowing fixed-point
+    /// value holds 0 in its fixed slot only.
+    bool isValid(std::size_t row) const { return valid_[row] != 0; }
+    void invalidate(std::size_t row) { valid_[row] = 0; }
+    const std::vector<uint8_t>& validity() const { return valid_; }
+    std::size_t invalidCount() const;
+
+private:
+    uint32_t packetId_ = 0;
+    std::string packetName_;
+    std::vector<Column> columns_;
+    std::vector<uint8_t> valid_;
+};
+
+} // namespace ionet::codec
+
+#endif
@@ -2,98 +2,295 @@
 #define IONET_CODEC_DECODED_PACKET_H
 
 #include "../core/Types.h"
-#include "../schema/Packet.h"
+#include "../schema/Schema.h"
+#include <memory_resource>
+#include <span>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 #include <optional>
 #include <cstdint>
 
 namespace ionet::codec {
 
-/// Decoded bitfield with named flags
+/// Decoded bitfield: the raw mask plus the definition naming its flags
+/// and subfields. A light view; subfield values are extracted on access.
+/// Resolve flag names once with Field::flagMask() and test the masks with
+/// any()/all(); isSet() looks the name up on every call.
 struct DecodedBitfield {
     uint64_t rawValue = 0;
-    std::unordered_map<std::string, bool> flags;
+    const schema::Field* def = nullptr;     // Owned by the schema
     
-    /// Check if a specific flag is set
-    bool isSet(const std::string& flagName) const;
+    /// Check if a named flag is set (false for unknown names)
+    bool isSet(std::string_view flagName) const;
+    
+    /// Raw value of a named subfield
+    std::optional<uint64_t> subfield(std::string_view subfieldName) const;
+    
+    /// Subfield value with its scaling applied (the raw value if unscaled)
+    std::optional<double> scaledSubfield(std::string_view subfieldName) const;
+    
+    /// Enum label of a subfield's value, or nullptr if it has none
+    const std::string* subfieldLabel(std::string_view subfieldName) const;
+    
+    /// Extract the raw subfield values, in def->subfields order, into `out`
+    /// in one pass (PEXT where available). Returns the number written.
+    std::size_t extractSubfields(std::span<uint64_t> out) const;
+    
+    /// True if any bit of `mask` is set
+    bool any(uint64_t mask) const { return (rawValue & mask) != 0; }
+    
+    /// True if every bit of `mask` is set
+    bool all(uint64_t mask) const { return (rawValue & mask) == mask; }
     
     /// Check if a specific bit is set
     bool bitAt(uint8_t bit) const;
 };
 
-/// A single decoded field value
+namespace detail {
+
+/// Out-of-line value of a string, bytes or array field, kept by its
+/// packet. Allocator-aware, so everything it owns comes from the packet's
+/// memory resource.
+struct Payload {
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+    
+    explicit Payload(const allocator_type& alloc = {});
+    Payload(const Payload& other, const allocator_type& alloc = {});
+    Payload(Payload&& other) = default;
+    Payload(Payload&& other, const allocator_type& alloc);
+    Payload& operator=(const Payload& other);
+    Payload& operator=(Payload&& other);
+    
+    /// Copy string or bytes contents into `contents`
+    void copy(std::span<const uint8_t> bytes);
+    
+    /// Refer to string or bytes contents in the frame instead of copying
+    void borrow(std::span<const uint8_t> bytes);
+    
+    /// String or bytes contents, copied or borrowed
+    std::span<const uint8_t> view() const { return borrowed ? frame : std::span<const uint8_t>(contents); }
+    
+    std::pmr::vector<uint8_t> contents;     // Copied string or bytes contents
+    std::span<const uint8_t> frame;         // Borrowed contents
+    bool borrowed = false;
+    core::ElementArray elements;            // Array elements at their declared width
+    std::pmr::vector<double> scaled;        // Scaled array elements, refilled in place
+};
+
+} // namespace detail
+
+/// A single decoded field value.
+///
+/// 32 bytes, so a packet's field list stays in cache: numeric, bitfield
+/// and bit-packed values sit in a 16-byte core::Scalar, and the name,
+/// unit and scaling are read through `def` from the schema, which must
+/// outlive the field. Strings, bytes and arrays live in the owning
+/// DecodedPacket, which must outlive the field too; the field holds a
+/// pointer to them in place of the scalar.
+///
+/// Scaling applies through def->scaling only when `scaled` is set. A
+/// scalar is scaled on access, at one multiply-add each time; an array is
+/// scaled as it is decoded, into storage its packet keeps and reuses, so
+/// reading a packet never writes to it.
 struct DecodedField {
-    std::string name;
-    core::DataType type;
-    core::Value rawValue;           // Value before scaling
-    core::Value scaledValue;        // Value after scaling (if applicable)
-    std::string unit;
+    DecodedField() : scalar_() {}
+    
+    const schema::Field* def = nullptr; // Owned by the schema
+    uint32_t index = 0;                 // Position in Packet::fields
+    core::DataType type = core::DataType::UInt8;
+    bool scaled = false;                // Scaling applies: defined and requested
+    
+    /// Raw numeric value (empty for strings, bytes and arrays)
+    core::Scalar scalar() const { return hasPayload_ ? core::Scalar() : scalar_; }
+    void setScalar(core::Scalar value) { scalar_ = value; hasPayload_ = false; }
+    
+    /// Name and unit from the definition (empty without one)
+    std::string_view name() const;
+    std::string_view unit() const;
+    
+    /// Value before scaling. Array elements are widened into an
+    /// IntArray, UIntArray or RealArray copy; elements() reads them in place.
+    core::Value rawValue() const;
     
-    /// For bitfields
-    std::optional<DecodedBitfield> bitfield;
+    /// Value after scaling; the raw value if the field is not scaled
+    core::Value scaledValue() const;
+    
+    /// Scaled elements of an array field, computed when it was decoded;
+    /// empty unless the field is a scaled array
+    std::span<const double> scaledArray() const;
+    
+    /// Elements of an array field at their declared width, in host byte
+    /// order (e.g. int16_t for an int16[64] block); empty unless T is the
+    /// field's element type
+    template<typename T>
+    std::span<const T> elements() const;
+    
+    /// Scaled value of an integer field in fixed point, computed in
+    /// integers with the factors the schema resolved, def->fixedScaling
+    /// (the raw value at exponent 0 if unscaled); nullopt for
+    /// other types, for scalings with no fixed-point form and for values
+    /// that do not fit in int64
+    std::optional<schema::FixedPoint> fixed() const;
     
     /// Get value as specific type (scaled if available, raw otherwise)
     template<typename T>
     std::optional<T> as() const;
     
     /// Get the display value (scaled if available)
-    core::Value value() const;
+    core::Value value() const { return scaledValue(); }
+    
+    /// Bitfield view over the raw mask (bitfield fields only)
+    std::optional<DecodedBitfield> bitfield() const;
+    
+    /// String contents, whether copied or borrowed from the frame
+    /// (empty for other types)
+    std::string_view text() const;
+    
+    /// Bytes contents, whether copied or borrowed from the frame
+    /// (empty for other types)
+    std::span<const uint8_t> bytes() const;
     
     /// Check if field has scaling applied
-    bool hasScaling() const;
+    bool hasScaling() const { return scaled; }
+
+private:
+    friend class Decoder;           // Fills payloads in place
+    friend class DecodedPacket;     // Owns and relocates them
+    
+    /// Scale an array payload into its `scaled` elements
+    void scalePayload();
+    
+    bool hasPayload_ = false;       // Next to `scaled`, in the padding
+    union {
+        core::Scalar scalar_;
+        detail::Payload* payload_;  // Element of the packet's payload list
+    };
 };
 
-/// Container for a fully decoded packet
+static_assert(sizeof(DecodedField) <= 32);
+
+/// Container for a fully decoded packet.
+///
+/// Allocator-aware: constructed with a std::pmr allocator (e.g. over a
+/// core::Arena, or as an element of a std::pmr::vector), its field and
+/// payload lists come from that memory resource, so a window of packets
+/// can be freed with one Arena::reset(). Owned string, bytes and array
+/// contents come from the same resource. Copies use the default resource
+/// and outlive the arena; copying or moving a packet repoints its fields
+/// at the new payload list.
+///
+/// The packet name and the name -> field index are the schema's interned
+/// schema::PacketNames, so building a packet copies no names, and fields
+/// refer to their definitions: the schema must outlive the packet.
 class DecodedPacket {
 public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+    
     DecodedPacket() = default;
-    DecodedPacket(uint32_t packetId, std::string packetName);
+    explicit DecodedPacket(const allocator_type& alloc);
+    DecodedPacket(uint32_t packetId, const schema::PacketNames* names, const allocator_type& alloc = {});
+    DecodedPacket(const DecodedPacket& other, const allocator_type& alloc = {});
+    DecodedPacket(DecodedPacket&& other) noexcept;      // Takes the payload list whole
+    DecodedPacket(DecodedPacket&& other, const allocator_type& alloc);
+    DecodedPacket& operator=(const DecodedPacket& other);
+    DecodedPacket& operator=(DecodedPacket&& other);
+    
+    allocator_type get_allocator() const { return fields_.get_allocator(); }
+    
+    /// Drop all fields and relabel, keeping allocated capacity
+    void reset(uint32_t packetId, const schema::PacketNames* names);
     
     /// Packet identification
     uint32_t id() const { return packetId_; }
-    const std::string& name() const { return packetName_; }
+    std::string_view name() const { return names_ ? names_->packet : std::string_view(); }
     
-    /// Field access
+    /// Field access. A field with a payload must have been decoded into
+    /// this packet.
     void addField(DecodedField field);
     
     std::size_t fieldCount() const { return fields_.size(); }
     
-    const DecodedField* field(const std::string& name) const;
+    const DecodedField* field(std::string_view name) const;
     const DecodedField* fieldAt(std::size_t index) const;
     
+    /// Field access by handle: no hashing, nullptr if the handle is for
+    /// another packet or the field was not decoded
+    const DecodedField* field(schema::FieldHandle handle) const;
+    
     /// Get all fields
-    const std::vector<DecodedField>& fields() const { return fields_; }
+    const std::pmr::vector<DecodedField>& fields() const { return fields_; }
     
     /// Convenience: get field value directly
     template<typename T>
-    std::optional<T> get(const std::string& fieldName) const;
+    std::optional<T> get(std::string_view fieldName) const;
+    
+    template<typename T>
+    std::optional<T> get(schema::FieldHandle handle) const;
     
     /// Check if packet has a field
-    bool hasField(const std::string& name) const;
+    bool hasField(std::string_view name) const;
+    bool hasField(schema::FieldHandle handle) const;
     
     /// Iterator support
     auto begin() const { return fields_.begin(); }
     auto end() const { return fields_.end(); }
 
 private:
+    friend class Decoder;   // Refills fields in place (Decoder::decodeInto)
+    
     uint32_t packetId_ = 0;
-    std::string packetName_;
-    std::vector<DecodedField> fields_;
-    std::unordered_map<std::string, std::size_t> fieldIndex_;
+    const schema::PacketNames* names_ = nullptr;   // Owned by the schema
+    std::pmr::vector<DecodedField> fields_;
+    std::pmr::vector<uint32_t> slots_;  // Packet::fields index -> fields_ position
+    std::pmr::vector<detail::Payload> payloads_;    // Strings, bytes and arrays
+    std::size_t usedPayloads_ = 0;      // Leading payloads_ held by fields; the rest wait for reuse
+    
+    static constexpr uint32_t kNoSlot = UINT32_MAX;
+    
+    /// Give `field` a payload slot; `field` may not be added yet
+    detail::Payload& attachPayload(DecodedField& field);
+    
+    /// Take back the slot of the last field given one, which is dropped
+    /// instead of added
+    void detachPayload(DecodedField& field);
+    
+    /// Drop all fields ahead of a refill. For the same packet type the
+    /// payloads stay and are handed out again in order, storage and all;
+    /// for another type the packet is reset.
+    void refill(uint32_t packetId, const schema::PacketNames* names);
+    
+    /// Repoint fields whose payloads were in the list at `from`
+    void rebase(const detail::Payload* from, std::size_t count);
 };
 
 // --- Template implementations ---
 
+namespace detail {
+
+/// Raw number in engineering units (kept in double, unlike Scaling::apply)
+inline double scaled(const schema::Scaling& scaling, double raw) {
+    return (raw * scaling.scale) + scaling.offset;
+}
+
+/// Convert a decoded value to T, allowing numeric conversions
 template<typename T>
-std::optional<T> DecodedField::as() const {
-    const auto& val = hasScaling() ? scaledValue : rawValue;
-    
+std::optional<T> valueAs(const core::Value& val) {
     if (std::holds_alternative<T>(val)) {
         return std::get<T>(val);
     }
     
+    // Borrowed payloads convert to owned copies
+    if constexpr (std::is_same_v<T, std::string>) {
+        if (const auto* str = std::get_if<std::string_view>(&val)) {
+            return std::string(*str);
+        }
+    } else if constexpr (std::is_same_v<T, std::vector<uint8_t>>) {
+        if (const auto* bytes = std::get_if<core::ByteView>(&val)) {
+            return std::vector<uint8_t>(bytes->begin(), bytes->end());
+        }
+    }
+    
     // Try numeric conversions
     if constexpr (std::is_arithmetic_v<T>) {
         if (std::holds_alternative<int64_t>(val)) {
@@ -110,8 +307,38 @@ std::optional<T> DecodedField::as() const {
     return std::nullopt;
 }
 
+} // namespace detail
+
 template<typename T>
-std::optional<T> DecodedPacket::get(const std::string& fieldName) const {
+std::optional<T> DecodedField::as() const {
+    if constexpr (std::is_arithmetic_v<T>) {
+        if (!hasPayload_ && !scalar_.empty()) {
+            return scaled ? static_cast<T>(detail::scaled(*def->scaling, scalar_.toDouble())) : scalar_.to<T>();
+        }
+    }
+    if (scaled) {
+        if constexpr (std::is_same_v<T, core::RealArray>) {
+            if (hasPayload_) {
+                return core::RealArray(payload_->scaled.begin(), payload_->scaled.end());
+            }
+        }
+        return detail::valueAs<T>(scaledValue());
+    }
+    return detail::valueAs<T>(rawValue());
+}
+
+template<typename T>
+std::span<const T> DecodedField::elements() const {
+    if (hasPayload_) {
+        if (const auto* array = std::get_if<std::pmr::vector<T>>(&payload_->elements)) {
+            return *array;
+        }
+    }
+    return {};
+}
+
+template<typename T>
+std::optional<T> DecodedPacket::get(std::string_view fieldName) const {
     const auto* f = field(fieldName);
     if (!f) {
         return std::nullopt;
@@ -119,6 +346,15 @@ std::optional<T> DecodedPacket::get(const std::string& fieldName) const {
     return f->as<T>();
 }
 
+template<typename T>
+std::optional<T> DecodedPacket::get(schema::FieldHandle handle) const {
+    const auto* f = field(handle);
+    if (!f) {
+        return std::nullopt;
+    }
+    return f->as<T>();
+}
+
 } // namespace ionet::codec
 
 #endif
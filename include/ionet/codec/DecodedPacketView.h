@@ -0,0 +1,101 @@
+#ifndef IONET_CODEC_DECODED_PACKET_VIEW_H
+#define IONET_CODEC_DECODED_PACKET_VIEW_H
+
+#include "CompiledSchema.h"
+#include "DecodedPacket.h"
+#include "../core/Types.h"
+#include <span>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <cstdint>
+
+namespace ionet::codec {
+
+/// Lightweight view over an encoded frame; fields are decoded on access.
+/// Holds no storage of its own: the frame bytes and the compiled schema
+/// (owned by the Decoder that made the view) must outlive it.
+/// Constraints are not checked. With `borrowPayloads`, string and bytes
+/// values reference the frame instead of copying it.
+class DecodedPacketView {
+public:
+    DecodedPacketView(
+        const CompiledPacket& plan,
+        std::span<const uint8_t> frame,
+        bool applyScaling = true,
+        bool borrowPayloads = false
+    );
+
+    /// Packet identification
+    uint32_t id() const { return plan_->id(); }
+    const std::string& name() const { return plan_->packet().name; }
+    const schema::Packet& definition() const { return plan_->packet(); }
+
+    /// Underlying frame bytes
+    std::span<const uint8_t> data() const { return frame_; }
+
+    std::size_t fieldCount() const { return plan_->fields().size(); }
+
+    /// Check if packet has a field. Names are looked up in the schema's
+    /// interned index, so lookups by literal allocate nothing.
+    bool hasField(std::string_view name) const;
+
+    /// Decode a field's value before scaling
+    core::Value raw(std::string_view fieldName) const;
+    core::Value rawAt(std::size_t index) const;
+
+    /// Decode a field's display value (scaled if applicable)
+    core::Value value(std::string_view fieldName) const;
+    core::Value valueAt(std::size_t index) const;
+
+    /// Convenience: decode field value as T
+    template<typename T>
+    std::optional<T> get(std::string_view fieldName) const;
+
+    template<typename T>
+    std::optional<T> getAt(std::size_t index) const;
+
+    template<typename T>
+    std::optional<T> get(schema::FieldHandle handle) const;
+
+private:
+    const CompiledPacket* plan_;
+    std::span<const uint8_t> frame_;
+    bool applyScaling_;
+    bool borrowPayloads_;
+
+    const FieldPlan* findPlan(std::string_view fieldName) const;
+    core::Value rawOf(const FieldPlan& plan) const;
+    core::Value valueOf(const FieldPlan& plan) const;
+};
+
+// --- Template implementations ---
+
+template<typename T>
+std::optional<T> DecodedPacketView::get(std::string_view fieldName) const {
+    const auto* plan = findPlan(fieldName);
+    if (!plan) {
+        return std::nullopt;
+    }
+    return detail::valueAs<T>(valueOf(*plan));
+}
+
+template<typename T>
+std::optional<T> DecodedPacketView::getAt(std::size_t index) const {
+    if (index >= plan_->fields().size()) {
+        return std::nullopt;
+    }
+    return detail::valueAs<T>(valueOf(plan_->fields()[index]));
+}
+
+template<typename T>
+std::optional<T> DecodedPacketView::get(schema::FieldHandle handle) const {
+    if (handle.packetId != id()) {
+        return std::nullopt;
+    }
+    return getAt<T>(handle.index);
+}
+
+} // namespace ionet::codec
+
+#endif
@@ -2,10 +2,15 @@
 #define IONET_CODEC_DECODER_H
 
 #include "DecodedPacket.h"
+#include "DecodedPacketView.h"
+#include "DecodedBatch.h"
+#include "CompiledSchema.h"
+#include "DecodeError.h"
 #include "../core/Result.h"
 #include "../core/ByteBuffer.h"
 #include "../schema/Schema.h"
 #include <span>
+#include <memory>
 #include <cstdint>
 
 namespace ionet::codec {
@@ -18,17 +23,42 @@ struct DecodeOptions {
     /// Validate constraints after decoding (default: true)
     bool validateConstraints = true;
     
+    /// With applyScaling off, compare constraint limits against the raw
+    /// values instead of scaling them first (default: false, limits are
+    /// always in engineering units)
+    bool rawConstraints = false;
+    
     /// Stop on first error vs collect all errors (default: true)
     bool stopOnError = true;
+    
+    /// Return string and bytes fields as std::string_view / core::ByteView
+    /// into the input buffer instead of copying them (default: false).
+    /// The decoded packet, view or Value then refers to the caller's bytes
+    /// and is valid only while they stay alive and unmodified; copy a field
+    /// (get<std::string>, get<std::vector<uint8_t>>) to keep it longer.
+    /// StreamDecoder and DecodePipeline keep the frame alive until the
+    /// packet callback returns.
+    bool borrowPayloads = false;
+    
+    /// Also scale integer batch columns in integers, into Column::fixed,
+    /// where the scaling has a fixed-point form (default: false). A value
+    /// that overflows int64 there fails the batch, or with stopOnError
+    /// unset invalidates its row.
+    bool fixedPointScaling = false;
 };
 
-/// Decoder for binary data using schema definitions
+/// Decoder for binary data using schema definitions.
+///
+/// Packets may be added to the schema after the decoder is built: its
+/// decode plans are rebuilt on the next call that notices. Plans already
+/// handed out (projections, views) stay valid for the decoder's lifetime.
+/// The schema must not change while a decode is running.
 class Decoder {
 public:
-    /// Construct decoder with schema reference
+    /// Construct decoder with schema reference; the schema must outlive it
     explicit Decoder(const schema::Schema& schema);
     
-    /// Construct decoder with schema and options
+    /// Construct decoder with schema and options; the schema must outlive it
     Decoder(const schema::Schema& schema, DecodeOptions options);
     
     /// Decode a packet by ID from raw bytes
@@ -49,47 +79,170 @@ public:
         std::span<const uint8_t> data
     ) const;
     
+    /// Decode into caller-owned storage. Refilling a packet of the same
+    /// type reuses its string, bytes and array storage, so it allocates
+    /// nothing once the payloads have grown to size: a fixed layout is
+    /// overwritten in place, and a variable layout or short frame read
+    /// field by field hands the payloads out again in field order.
+    /// Decoding another packet type resets `out`: the field and payload
+    /// lists keep their capacity, but owned payload contents are freed
+    /// and allocated again. On failure `out` holds unspecified values but
+    /// keeps its storage. Failures are reported by status without
+    /// throwing or allocating; `errorOut` receives the details if given.
+    DecodeStatus decodeInto(
+        uint32_t packetId,
+        std::span<const uint8_t> data,
+        DecodedPacket& out,
+        DecodeError* errorOut = nullptr
+    ) const;
+    
     /// Decode using ByteBufferReader (for streaming)
     core::Result<DecodedPacket> decode(
         uint32_t packetId,
         core::ByteBufferReader& reader
     ) const;
     
+    /// Resolve field names to a projection for a fixed-size packet
+    core::Result<Projection> project(
+        uint32_t packetId,
+        const std::vector<std::string>& fieldNames
+    ) const;
+    
+    /// Build a projection from handles, which must all name one packet
+    core::Result<Projection> project(
+        const std::vector<schema::FieldHandle>& fields
+    ) const;
+    
+    /// Decode only the projected fields; others are skipped entirely
+    core::Result<DecodedPacket> decode(
+        const Projection& projection,
+        std::span<const uint8_t> data
+    ) const;
+    
+    /// Wrap a fixed-size frame without decoding it; fields decode on access.
+    /// Checks the packet ID and frame length only.
+    core::Result<DecodedPacketView> view(
+        uint32_t packetId,
+        std::span<const uint8_t> data
+    ) const;
+    
+    /// Decode many frames of one fixed-size packet type into typed columns
+    core::Result<DecodedBatch> decodeBatch(
+        uint32_t packetId,
+        std::span<const std::span<const uint8_t>> frames
+    ) const;
+    
+    /// Decode frames stored back to back, one every `stride` bytes
+    core::Result<DecodedBatch> decodeBatch(
+        uint32_t packetId,
+        std::span<const uint8_t> data,
+        std::size_t stride
+    ) const;
+    
     /// Get/set options
     const DecodeOptions& options() const { return options_; }
     void setOptions(DecodeOptions options) { options_ = options; }
     
     /// Get schema reference
     const schema::Schema& schema() const { return schema_; }
+    
+    /// Get the precompiled decode plans, rebuilt if packets were added
+    /// to the schema since they were compiled
+    const CompiledSchema& compiled() const;
 
 private:
+    /// Every set of plans compiled so far, newest current (Decoder.cpp)
+    struct Plans;
+    
     const schema::Schema& schema_;
+    std::shared_ptr<Plans> plans_;
     DecodeOptions options_;
     
-    /// Decode a single field
-    core::Result<DecodedField> decodeField(
+    /// Decode a fixed-size packet from a frame already known to be long enough
+    core::Result<DecodedPacket> decodeCompiled(
+        const CompiledPacket& plan,
+        const uint8_t* frame,
+        const Projection* projection = nullptr
+    ) const;
+    
+    /// Find the plan for a known fixed-size packet
+    const CompiledPacket* findFixedPlan(
+        uint32_t packetId,
+        std::string* errorMsg
+    ) const;
+    
+    /// Decode validated rows (nullptr for frames that were too short)
+    core::Result<DecodedBatch> decodeRows(
+        const CompiledPacket& plan,
+        const std::vector<const uint8_t*>& rows
+    ) const;
+    
+    /// Decode a single field at its precomputed offset; `bits` spans the
+    /// frame and carries the window between bit-packed fields. A string,
+    /// bytes or array value goes into `out`, which the field must be added to.
+    DecodedField decodeField(
+        const FieldPlan& plan,
+        const uint8_t* frame,
+        core::BitReader& bits,
+        DecodedPacket& out
+    ) const;
+    
+    /// Refill an existing field's values from its precomputed offset
+    void fillField(
+        const FieldPlan& plan,
+        const uint8_t* frame,
+        core::BitReader& bits,
+        DecodedField& field
+    ) const;
+    
+    /// Decode fields one by one from the reader's position, appending them to `out`
+    DecodeStatus decodeFields(
+        const CompiledPacket& plan,
+        core::ByteBufferReader& reader,
+        DecodedPacket& out,
+        DecodeError* errorOut
+    ) const;
+    
+    /// Decode a single field; the reader is left at the failing field on error
+    DecodeStatus decodeField(
         const schema::Field& fieldDef,
         core::ByteBufferReader& reader,
-        core::ByteOrder byteOrder
+        core::ByteOrder byteOrder,
+        DecodedField& field
     ) const;
     
-    /// Decode a bitfield
-    DecodedBitfield decodeBitfield(
-        uint64_t rawValue,
-        const schema::Field& fieldDef
+    /// Decode a string, bytes or array field whose length is held by an
+    /// earlier field already in `out`; `needed` receives its size in bytes
+    DecodeStatus decodeVariableField(
+        const FieldPlan& plan,
+        const DecodedPacket& out,
+        core::ByteBufferReader& reader,
+        core::ByteOrder byteOrder,
+        std::size_t& needed,
+        DecodedField& field
     ) const;
     
-    /// Apply scaling to a value
-    core::Value applyScaling(
-        const core::Value& rawValue,
-        const schema::Scaling& scaling
+    /// Decode a bit-packed field starting at `bitPos` (or its declared bit
+    /// offset) from the packet start; advances `bitPos` and the reader
+    DecodeStatus decodePackedField(
+        const schema::Field& fieldDef,
+        core::ByteBufferReader& reader,
+        std::size_t packetStart,
+        std::size_t& bitPos,
+        DecodedField& field
     ) const;
     
-    /// Validate field constraints
-    bool validateConstraints(
+    /// Point a field at its definition and mark it scaled, per the options
+    void describeField(const schema::Field& fieldDef, DecodedField& field) const;
+    
+    /// Validate field constraints, filling the value and limit into `errorOut`.
+    /// Limits are in engineering units: raw values of a scaled field are
+    /// scaled before the comparison unless DecodeOptions::rawConstraints
+    /// is set and scaling is off.
+    DecodeStatus validateConstraints(
         const DecodedField& field,
         const schema::Field& fieldDef,
-        std::string* errorMsg
+        DecodeError* errorOut
     ) const;
 };
 
@@ -0,0 +1,90 @@
+#ifndef IONET_CODEC_PACKET_DISPATCH_H
+#define IONET_CODEC_PACKET_DISPATCH_H
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ionet::codec {
+
+/// Maps packet IDs to plan indices with a table built once from the
+/// complete ID set.
+///
+/// Dense ID ranges get a direct array indexed by `id - minId`. Sparse sets
+/// get a collision-free multiplicative hash (the multiplier is searched for
+/// at build time), so a lookup is one multiply, one load and one compare.
+/// Large sparse sets for which no small perfect table exists fall back to
+/// binary search over the sorted IDs.
+class PacketDispatch {
+public:
+    enum class Kind : uint8_t { Empty, Dense, PerfectHash, Sorted };
+
+    static constexpr uint32_t kNotFound = UINT32_MAX;
+
+    PacketDispatch() = default;
+
+    /// Build for `ids`, where ids[i] maps to index i. A repeated ID maps
+    /// to its last index, as Schema::findPacketById resolves it.
+    explicit PacketDispatch(std::span<const uint32_t> ids);
+
+    /// Index registered for `id`, or kNotFound
+    uint32_t find(uint32_t id) const {
+        switch (kind_) {
+            case Kind::Dense: {
+                uint32_t slot = id - base_;
+                return slot < dense_.size() ? dense_[slot] : kNotFound;
+            }
+            case Kind::PerfectHash: {
+                const Entry& entry = table_[hash(id)];
+                return entry.id == id ? entry.index : kNotFound;
+            }
+            case Kind::Sorted:
+                return findSorted(id);
+            case Kind::Empty:
+                break;
+        }
+        return kNotFound;
+    }
+
+    Kind kind() const { return kind_; }
+
+    /// Slots in the dense array or hash table (0 for Sorted/Empty)
+    std::size_t tableSize() const {
+        return kind_ == Kind::Dense ? dense_.size() : (kind_ == Kind::PerfectHash ? table_.size() : 0);
+    }
+
+private:
+    struct Entry {
+        uint32_t id = 0;
+        uint32_t index = kNotFound;     // kNotFound marks an empty slot
+    };
+
+    uint32_t hash(uint32_t id) const {
+        return static_cast<uint32_t>((id * multiplier_) >> shift_);
+    }
+
+    using Entries = std::vector<std::pair<uint32_t, uint32_t>>;    // (id, index)
+    
+    bool tryDense(const Entries& entries);
+    bool tryPerfectHash(const Entries& entries);
+    uint32_t findSorted(uint32_t id) const;
+
+    Kind kind_ = Kind::Empty;
+
+    // Dense
+    uint32_t base_ = 0;
+    std::vector<uint32_t> dense_;
+
+    // PerfectHash
+    uint64_t multiplier_ = 0;
+    unsigned shift_ = 64;
+    std::vector<Entry> table_;
+
+    // Sorted: (id, index) ordered by id
+    Entries sorted_;
+};
+
+} // namespace ionet::codec
+
+#endif
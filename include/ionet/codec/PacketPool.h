@@ -0,0 +1,47 @@
+#ifndef IONET_CODEC_PACKET_POOL_H
+#define IONET_CODEC_PACKET_POOL_H
+
+#include "DecodedPacket.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ionet::codec {
+
+/// Thread-safe pool of reusable DecodedPacket objects.
+/// Packets keep their storage across uses, so an ingest thread can
+/// decodeInto() an acquired packet, hand it to a consumer thread, and get
+/// it back without touching the heap once the pool is warm.
+/// The pool must outlive every handle it gives out.
+class PacketPool {
+public:
+    /// Returns a packet to its pool when the handle is destroyed
+    struct Releaser {
+        PacketPool* pool = nullptr;
+        void operator()(DecodedPacket* packet) const;
+    };
+
+    using Handle = std::unique_ptr<DecodedPacket, Releaser>;
+
+    /// Construct with packets allocated up front
+    explicit PacketPool(std::size_t preallocate = 0);
+
+    PacketPool(const PacketPool&) = delete;
+    PacketPool& operator=(const PacketPool&) = delete;
+
+    /// Take a packet from the pool, allocating one only if it is empty
+    Handle acquire();
+
+    /// Number of idle packets in the pool
+    std::size_t available() const;
+
+private:
+    void release(DecodedPacket* packet);
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<DecodedPacket>> free_;
+};
+
+} // namespace ionet::codec
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef IONET_CODEC_STREAM_DECODER_H
+#define IONET_CODEC_STREAM_DECODER_H
+
+#include "Decoder.h"
+#include "DecodeError.h"
+#include "../core/SyncScanner.h"
+#include "../schema/FrameHeader.h"
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace ionet::codec {
+
+/// Counters kept by a StreamDecoder
+struct StreamStats {
+    uint64_t bytesReceived = 0;
+    uint64_t framesDecoded = 0;
+    uint64_t bytesSkipped = 0;      // Discarded while hunting for a frame start
+    uint64_t resyncs = 0;           // Times the search had to skip bytes
+    DecodeErrorCounts errors;       // Rejected headers and failed decodes
+};
+
+/// Finds frames in an arbitrarily chunked byte stream and decodes them.
+///
+/// Frames are located with the schema's FrameHeader: the sync word marks
+/// the start (found with a SyncScanner on its first 4 bytes), the id field
+/// selects the packet and the length field (or the packet's fixed size)
+/// gives the payload length. Complete frames are
+/// decoded straight out of the chunk passed to feed(); only a frame split
+/// across chunks is copied, into an internal buffer that keeps its capacity.
+///
+/// A header that names an unknown packet or an impossible length is
+/// treated as noise: one byte is skipped and the search resumes.
+class StreamDecoder {
+public:
+    /// Receives each decoded packet. The packet is reused for the next
+    /// frame, so copy anything that must outlive the call.
+    using PacketCallback = std::function<void(const DecodedPacket&)>;
+
+    /// Receives each rejected header or failed decode
+    using ErrorCallback = std::function<void(const DecodeError&)>;
+
+    /// Frame with the schema's header; throws std::invalid_argument if it has none
+    StreamDecoder(const Decoder& decoder, PacketCallback onPacket);
+
+    /// Frame with an explicit header
+    StreamDecoder(const Decoder& decoder, schema::FrameHeader header, PacketCallback onPacket);
+
+    void setErrorCallback(ErrorCallback onError) { onError_ = std::move(onError); }
+
+    /// Frames declaring more payload than this are rejected (default 64 KiB)
+    void setMaxPayloadSize(std::size_t bytes) { maxPayload_ = bytes; }
+
+    /// Consume the next chunk of the stream; returns packets decoded from it
+    std::size_t feed(std::span<const uint8_t> chunk);
+
+    /// Bytes of an incomplete frame held back for the next chunk
+    std::size_t buffered() const { return pending_.size(); }
+
+    /// Drop any partial frame (e.g. after a reconnect)
+    void reset() { pending_.clear(); }
+
+    const StreamStats& stats() const { return stats_; }
+    const schema::FrameHeader& header() const { return header_; }
+
+private:
+    /// What the bytes at a candidate frame start say
+    struct Probe {
+        enum class Kind { Frame, NeedMore, Invalid } kind;
+        std::size_t length = 0;         // Frame: total bytes; NeedMore: bytes to look at next
+        uint32_t packetId = 0;
+        DecodeStatus error = DecodeStatus::Ok;
+    };
+
+    Probe probe(std::span<const uint8_t> frame) const;
+
+    /// Decode frames in place; buffers a trailing partial frame
+    void scan(std::span<const uint8_t> data);
+
+    /// Grow the buffered partial frame from `chunk`; returns the unused rest
+    std::span<const uint8_t> completePending(std::span<const uint8_t> chunk);
+
+    void emit(std::span<const uint8_t> frame, uint32_t packetId);
+    void reject(const Probe& probe);
+
+    const Decoder& decoder_;
+    schema::FrameHeader header_;
+    std::optional<core::SyncScanner> scanner_;      // Unset when there is no sync word
+    PacketCallback onPacket_;
+    ErrorCallback onError_;
+    std::size_t maxPayload_ = 64 * 1024;
+
+    std::vector<uint8_t> pending_;      // Partial frame carried between chunks
+    std::vector<uint8_t> rescan_;       // Pending bytes being searched again after a bad header
+    DecodedPacket packet_;              // Reused for every frame
+    std::size_t emitted_ = 0;
+    StreamStats stats_;
+};
+
+} // namespace ionet::codec
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef IONET_CORE_ARENA_H
+#define IONET_CORE_ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace ionet::core {
+
+/// Bump allocator for data that is thrown away all at once, usable
+/// wherever a std::pmr::memory_resource is accepted.
+///
+/// Allocation advances a pointer through chunks taken from the upstream
+/// resource and deallocate() does nothing. reset() makes every chunk
+/// reusable without returning it upstream, so a steady cycle of
+/// decode-then-reset allocates nothing after the first window. Not
+/// thread-safe: give each thread its own arena.
+class Arena : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t kDefaultChunkSize = 64 * 1024;
+
+    explicit Arena(
+        std::size_t chunkSize = kDefaultChunkSize,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    );
+
+    ~Arena() override;
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// Free everything allocated so far at once; chunks are kept for reuse.
+    /// Objects using the arena must already be destroyed or abandoned.
+    void reset();
+
+    /// reset() and return every chunk to the upstream resource
+    void release();
+
+    /// Bytes handed out since the last reset (including alignment padding)
+    std::size_t bytesUsed() const { return used_ + static_cast<std::size_t>(next_ - begin_); }
+
+    /// Bytes held in chunks
+    std::size_t capacity() const { return capacity_; }
+
+    std::size_t chunkCount() const { return chunks_.size(); }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    struct Chunk {
+        std::byte* data = nullptr;
+        std::size_t size = 0;
+    };
+
+    /// Move to the next chunk with room for `bytes` at `alignment`, adding one if needed
+    void advance(std::size_t bytes, std::size_t alignment);
+
+    std::size_t chunkSize_;
+    std::pmr::memory_resource* upstream_;
+    std::vector<Chunk> chunks_;
+    std::size_t current_ = 0;       // Chunk being filled
+    std::size_t used_ = 0;          // Bytes used in chunks before the current one
+    std::size_t capacity_ = 0;
+    std::byte* begin_ = nullptr;    // Current chunk
+    std::byte* next_ = nullptr;
+    std::byte* end_ = nullptr;
+};
+
+} // namespace ionet::core
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef IONET_CORE_BIT_READER_H
+#define IONET_CORE_BIT_READER_H
+
+#include "Endian.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace ionet::core {
+
+/// Sign-extend the low `width` bits of `value` (width 1-64)
+inline int64_t signExtend(uint64_t value, unsigned width) {
+    const unsigned shift = 64 - width;
+    return static_cast<int64_t>(value << shift) >> shift;
+}
+
+/// Reads bit-packed values MSB-first: bit 0 of the data is the most
+/// significant bit of its first byte, and each value's bits run from most
+/// to least significant.
+///
+/// Bits are served from a 64-bit window refilled with one unaligned 8-byte
+/// load, so runs of narrow fields (e.g. 12-bit samples) share loads. The
+/// reader never touches bytes outside the span.
+class BitReader {
+public:
+    BitReader() = default;
+
+    explicit BitReader(std::span<const uint8_t> data, std::size_t bitPos = 0)
+        : begin_(data.data())
+        , end_(data.data() + data.size())
+    {
+        seek(bitPos);
+    }
+
+    /// Bit position from the start of the data
+    std::size_t position() const {
+        return static_cast<std::size_t>(next_ - begin_) * 8 - count_;
+    }
+
+    /// Bits left to read
+    std::size_t remaining() const {
+        return static_cast<std::size_t>(end_ - next_) * 8 + count_;
+    }
+
+    /// Move to a bit position (clamped to the end of the data)
+    void seek(std::size_t bitPos) {
+        std::size_t bytes = static_cast<std::size_t>(end_ - begin_);
+        if (bitPos > bytes * 8) {
+            bitPos = bytes * 8;
+        }
+        next_ = begin_ + bitPos / 8;
+        window_ = 0;
+        count_ = 0;
+        if (unsigned skip = bitPos % 8) {
+            refill();
+            consume(skip);
+        }
+    }
+
+    /// Read `width` (1-64) bits; false, reading nothing, if fewer remain
+    bool tryRead(unsigned width, uint64_t& out) {
+        if (width == 0 || width > 64 || remaining() < width) {
+            return false;
+        }
+        out = read(width);
+        return true;
+    }
+
+    /// Read `width` (1-64) bits as a two's complement value
+    bool tryReadSigned(unsigned width, int64_t& out) {
+        uint64_t bits = 0;
+        if (!tryRead(width, bits)) {
+            return false;
+        }
+        out = signExtend(bits, width);
+        return true;
+    }
+
+    /// Read `width` (1-64) bits without checking remaining(); missing bits read as 0
+    uint64_t read(unsigned width) {
+        if (width > 56) {
+            // One refill guarantees only 56 bits
+            uint64_t high = read(width - 32);
+            return (high << 32) | read(32);
+        }
+        if (count_ < width) {
+            refill();
+        }
+        uint64_t value = window_ >> (64 - width);
+        consume(width);
+        return value;
+    }
+
+private:
+    /// Top up the window to at least 56 bits (or the end of the data)
+    void refill() {
+        if (end_ - next_ >= 8) {
+            // Bits past the whole bytes taken are loaded again next time
+            window_ |= endian::load<uint64_t>(next_, ByteOrder::Big) >> count_;
+            unsigned take = (63 - count_) / 8;
+            next_ += take;
+            count_ += take * 8;
+        } else {
+            while (count_ <= 56 && next_ < end_) {
+                window_ |= static_cast<uint64_t>(*next_++) << (56 - count_);
+                count_ += 8;
+            }
+        }
+    }
+
+    void consume(unsigned width) {
+        window_ <<= width;
+        count_ = width > count_ ? 0 : count_ - width;
+    }
+
+    const uint8_t* begin_ = nullptr;
+    const uint8_t* next_ = nullptr;
+    const uint8_t* end_ = nullptr;
+    uint64_t window_ = 0;           // Unread bits, left-aligned
+    unsigned count_ = 0;            // Valid bits in the window
+};
+
+} // namespace ionet::core
+
+#endif
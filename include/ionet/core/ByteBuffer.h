@@ -6,7 +6,9 @@
 #include <vector>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 
 namespace ionet::core {
@@ -43,6 +45,13 @@ public:
 
 private:
     std::vector<uint8_t> buffer_;
+
+    template<typename T>
+    void append(T value, ByteOrder order) {
+        std::size_t at = buffer_.size();
+        buffer_.resize(at + sizeof(T));
+        endian::store(value, buffer_.data() + at, order);
+    }
 };
 
 /// Reader for parsing binary buffers
@@ -68,10 +77,36 @@ public:
     std::vector<uint8_t> readBytes(std::size_t count);
     std::string readString(std::size_t size);
 
+    // Non-throwing reads: return false and leave the position unchanged
+    // when fewer bytes remain than the value needs
+    bool tryReadInt8(int8_t& out);
+    bool tryReadInt16(int16_t& out, ByteOrder order = ByteOrder::Native);
+    bool tryReadInt32(int32_t& out, ByteOrder order = ByteOrder::Native);
+    bool tryReadInt64(int64_t& out, ByteOrder order = ByteOrder::Native);
+
+    bool tryReadUInt8(uint8_t& out);
+    bool tryReadUInt16(uint16_t& out, ByteOrder order = ByteOrder::Native);
+    bool tryReadUInt32(uint32_t& out, ByteOrder order = ByteOrder::Native);
+    bool tryReadUInt64(uint64_t& out, ByteOrder order = ByteOrder::Native);
+
+    bool tryReadFloat32(float& out, ByteOrder order = ByteOrder::Native);
+    bool tryReadFloat64(double& out, ByteOrder order = ByteOrder::Native);
+
+    /// View the next `count` bytes without copying
+    bool tryReadBytes(std::size_t count, std::span<const uint8_t>& out);
+    bool tryReadString(std::size_t size, std::string_view& out);
+
+    bool trySkip(std::size_t count);
+
+    /// Check that at least `count` bytes remain, e.g. to validate a whole
+    /// frame once before reading it field by field
+    bool has(std::size_t count) const { return count <= size_ - pos_; }
+
     // Position control
     std::size_t position() const { return pos_; }
     std::size_t remaining() const { return size_ - pos_; }
     std::size_t size() const { return size_; }
+    const uint8_t* data() const { return data_; }
     bool atEnd() const { return pos_ >= size_; }
 
     void seek(std::size_t pos);
@@ -84,6 +119,16 @@ private:
     std::size_t pos_ = 0;
 
     void checkRemaining(std::size_t needed) const;
+
+    template<typename T>
+    bool tryLoad(T& out, ByteOrder order) {
+        if (!has(sizeof(T))) {
+            return false;
+        }
+        out = endian::load<T>(data_ + pos_, order);
+        pos_ += sizeof(T);
+        return true;
+    }
 };
 
 } // namespace ionet::core
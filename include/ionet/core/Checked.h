@@ -0,0 +1,67 @@
+#ifndef IONET_CORE_CHECKED_H
+#define IONET_CORE_CHECKED_H
+
+#include <cstdint>
+#include <limits>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define IONET_OVERFLOW_BUILTINS 1
+#endif
+
+namespace ionet::core::checked {
+
+// Each operation stores the result in `out` and returns false if it does
+// not fit in int64 (`out` is then unspecified). GCC and Clang use their
+// overflow builtins; other compilers test the operands up front.
+
+inline bool add(int64_t a, int64_t b, int64_t& out) {
+#ifdef IONET_OVERFLOW_BUILTINS
+    return !__builtin_add_overflow(a, b, &out);
+#else
+    constexpr auto max = std::numeric_limits<int64_t>::max();
+    constexpr auto min = std::numeric_limits<int64_t>::min();
+    if ((b > 0 && a > max - b) || (b < 0 && a < min - b)) {
+        return false;
+    }
+    out = a + b;
+    return true;
+#endif
+}
+
+inline bool sub(int64_t a, int64_t b, int64_t& out) {
+#ifdef IONET_OVERFLOW_BUILTINS
+    return !__builtin_sub_overflow(a, b, &out);
+#else
+    constexpr auto max = std::numeric_limits<int64_t>::max();
+    constexpr auto min = std::numeric_limits<int64_t>::min();
+    if ((b < 0 && a > max + b) || (b > 0 && a < min + b)) {
+        return false;
+    }
+    out = a - b;
+    return true;
+#endif
+}
+
+inline bool mul(int64_t a, int64_t b, int64_t& out) {
+#ifdef IONET_OVERFLOW_BUILTINS
+    return !__builtin_mul_overflow(a, b, &out);
+#else
+    constexpr auto max = std::numeric_limits<int64_t>::max();
+    constexpr auto min = std::numeric_limits<int64_t>::min();
+    if (a > 0) {
+        if (b > 0 ? a > max / b : b < min / a) {
+            return false;
+        }
+    } else if (a < 0) {
+        if (b > 0 ? a < min / b : b != 0 && a < max / b) {
+            return false;
+        }
+    }
+    out = a * b;
+    return true;
+#endif
+}
+
+} // namespace ionet::core::checked
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "Types.h"
 #include <bit>
+#include <cstdint>
 #include <concepts>
 #include <cstring>
 #include <type_traits>
@@ -81,5 +82,28 @@ T convert(T value, ByteOrder from) {
         }
     }
 
+/// Load a value stored in the given byte order from unaligned memory
+template<typename T>
+T load(const uint8_t* src, ByteOrder from) {
+        T value;
+        std::memcpy(&value, src, sizeof(T));
+        return convert(value, from);
+    }
+
+/// Load a value from unaligned memory, byte swapping when `swap` is set
+template<std::integral T>
+T loadSwapped(const uint8_t* src, bool swap) {
+        T value;
+        std::memcpy(&value, src, sizeof(T));
+        return swap ? byteSwap(value) : value;
+    }
+
+/// Store a value in the given byte order to unaligned memory
+template<typename T>
+void store(T value, uint8_t* dst, ByteOrder to) {
+        value = convert(value, to);
+        std::memcpy(dst, &value, sizeof(T));
+    }
+
 } // namespace ionet::core::endian
 #endif
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef IONET_CORE_FRAME_SLAB_H
+#define IONET_CORE_FRAME_SLAB_H
+
+#include "SpscQueue.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace ionet::core {
+
+/// Location of one frame inside a FrameSlab. Small and trivially copyable,
+/// so it is what travels through SpscQueue/MpscQueue instead of the bytes.
+struct FrameDescriptor {
+    uint64_t position = 0;      // Monotonic byte position within the lane
+    uint32_t length = 0;
+    uint32_t tag = 0;           // Caller-defined, e.g. the packet ID
+    uint32_t lane = 0;
+};
+
+/// Shared byte storage that producer threads write frames into once.
+///
+/// The slab is split into lanes, each a circular byte buffer with exactly
+/// one writer (e.g. one socket reader thread) and one releaser (the
+/// consumer). A frame is written contiguously; if it would straddle the
+/// end of a lane the writer skips to its start. Consumers read frames in
+/// place and release them in the order they were written to that lane,
+/// which both SpscQueue and MpscQueue preserve per producer.
+class FrameSlab {
+public:
+    FrameSlab(std::size_t lanes, std::size_t bytesPerLane);
+
+    FrameSlab(const FrameSlab&) = delete;
+    FrameSlab& operator=(const FrameSlab&) = delete;
+
+    std::size_t laneCount() const { return lanes_.size(); }
+    std::size_t laneCapacity() const { return laneBytes_; }
+
+    /// Writer of `lane`: copy a frame in; nullopt while the lane is too full
+    std::optional<FrameDescriptor> write(uint32_t lane, std::span<const uint8_t> frame, uint32_t tag = 0);
+
+    /// Bytes of a written, unreleased frame
+    std::span<const uint8_t> read(const FrameDescriptor& frame) const {
+        return {base(frame.lane) + (frame.position % laneBytes_), frame.length};
+    }
+
+    /// Consumer: free a frame and everything written to its lane before it
+    void release(const FrameDescriptor& frame) {
+        lanes_[frame.lane]->released.store(frame.position + frame.length, std::memory_order_release);
+    }
+
+    /// Bytes in use in a lane (written, not yet released)
+    std::size_t used(uint32_t lane) const;
+
+private:
+    struct Lane {
+        alignas(kCacheLine) std::atomic<uint64_t> written{0};      // Writer only
+        alignas(kCacheLine) std::atomic<uint64_t> released{0};     // Consumer only
+    };
+
+    uint8_t* base(uint32_t lane) const { return storage_.get() + lane * laneBytes_; }
+
+    std::size_t laneBytes_;
+    std::unique_ptr<uint8_t[]> storage_;
+    std::vector<std::unique_ptr<Lane>> lanes_;
+};
+
+} // namespace ionet::core
+
+#endif
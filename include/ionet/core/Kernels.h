@@ -0,0 +1,75 @@
+#ifndef IONET_CORE_KERNELS_H
+#define IONET_CORE_KERNELS_H
+
+#include "Types.h"
+#include <cstddef>
+#include <cstdint>
+
+/// Bulk conversion and search kernels for runs of packed values.
+/// Each entry point picks an SSSE3 or AVX2 implementation at runtime when
+/// the library is built with IONET_ENABLE_SIMD on x86, and falls back to
+/// portable scalar code otherwise. Every path converts bit-exactly.
+namespace ionet::core::kernels {
+
+/// Instruction set used by the kernels
+enum class KernelSet {
+    Scalar,
+    SSSE3,
+    AVX2
+};
+
+/// Kernel set selected for this process
+KernelSet activeKernelSet();
+
+/// Name of a kernel set ("scalar", "ssse3", "avx2")
+const char* kernelSetName(KernelSet set);
+
+/// Reverse the bytes of `count` 2/4/8-byte elements. src and dst may alias.
+void byteSwap16(const uint8_t* src, uint8_t* dst, std::size_t count);
+void byteSwap32(const uint8_t* src, uint8_t* dst, std::size_t count);
+void byteSwap64(const uint8_t* src, uint8_t* dst, std::size_t count);
+
+/// Convert `count` packed elements stored in `order` to int64.
+/// `type` must be a signed integer type.
+void toInt64(DataType type, const uint8_t* src, std::size_t count, ByteOrder order, int64_t* out);
+
+/// Convert `count` packed elements stored in `order` to uint64.
+/// `type` must be an unsigned integer type.
+void toUInt64(DataType type, const uint8_t* src, std::size_t count, ByteOrder order, uint64_t* out);
+
+/// Convert `count` packed elements stored in `order` to double.
+/// `type` must be Float32 or Float64.
+void toDouble(DataType type, const uint8_t* src, std::size_t count, ByteOrder order, double* out);
+
+/// Convert `count` packed numeric elements stored in `order` straight to
+/// (element * scale) + offset. 16- and 32-bit integers go from their own
+/// width to double in vector registers, without a round trip through int64.
+void toScaled(DataType type, const uint8_t* src, std::size_t count, ByteOrder order,
+              double scale, double offset, double* out);
+
+/// out[i] = (in[i] * scale) + offset
+void scale(const int64_t* in, std::size_t count, double scale, double offset, double* out);
+void scale(const uint64_t* in, std::size_t count, double scale, double offset, double* out);
+void scale(const double* in, std::size_t count, double scale, double offset, double* out);
+
+/// out[i] = (in[i] * multiplier) + bias, in integers (fixed-point scaling).
+/// Wraps on overflow.
+void scaleFixed(const int64_t* in, std::size_t count, int64_t multiplier, int64_t bias, int64_t* out);
+void scaleFixed(const uint64_t* in, std::size_t count, int64_t multiplier, int64_t bias, int64_t* out);
+
+/// Offset of the first occurrence of `pattern` (`length` bytes) in `data`,
+/// or of a leading part of it cut off by the end of the data; `size` if
+/// neither. An empty pattern matches at 0.
+std::size_t findSync(const uint8_t* data, std::size_t size, const uint8_t* pattern, std::size_t length);
+
+/// out[i] = bits of `value` selected by masks[i], packed down to bit 0
+/// (parallel bit extract). Uses BMI2 PEXT when the CPU has it. masks and
+/// out may alias.
+void extractBits(uint64_t value, const uint64_t* masks, std::size_t count, uint64_t* out);
+
+/// True if extractBits() runs on BMI2 PEXT
+bool hasPext();
+
+} // namespace ionet::core::kernels
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef IONET_CORE_MPSC_QUEUE_H
+#define IONET_CORE_MPSC_QUEUE_H
+
+#include "SpscQueue.h"
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ionet::core {
+
+/// Bounded lock-free queue for many producer threads and one consumer.
+///
+/// Each slot carries a sequence number telling producers and the consumer
+/// whose turn it is, so producers only contend on one CAS of the tail
+/// index. Same in-place interface as SpscQueue. Capacity is rounded up to
+/// a power of two.
+template<typename T>
+class MpscQueue {
+public:
+    explicit MpscQueue(std::size_t capacity)
+        : capacity_(detail::ringCapacity(capacity))
+        , mask_(capacity_ - 1)
+        , slots_(std::make_unique<Slot[]>(capacity_))
+    {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    std::size_t capacity() const { return capacity_; }
+
+    /// Producer (any thread): fill the next free slot with `fill(T&)`; false when full
+    template<typename Fill>
+        requires std::invocable<Fill&, T&>
+    bool tryPush(Fill&& fill) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[tail & mask_];
+            std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence - tail);
+
+            if (diff == 0) {
+                // Slot is free for this position: claim it
+                if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    fill(slot.value);
+                    slot.sequence.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Consumer has not freed this slot yet
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);  // Another producer won
+            }
+        }
+    }
+
+    /// Producer (any thread): copy a value into the next free slot; false when full
+    bool tryPush(const T& value) {
+        return tryPush([&](T& slot) { slot = value; });
+    }
+
+    /// Consumer: oldest item, or nullptr when empty. Valid until pop().
+    T* front() {
+        Slot& slot = slots_[head_ & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            return nullptr;
+        }
+        return &slot.value;
+    }
+
+    /// Consumer: release the item returned by front()
+    void pop() {
+        slots_[head_ & mask_].sequence.store(head_ + capacity_, std::memory_order_release);
+        ++head_;
+    }
+
+private:
+    // Padded so producers filling neighbouring slots do not false-share
+    struct alignas(kCacheLine) Slot {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};   // Shared by producers
+    alignas(kCacheLine) std::size_t head_ = 0;              // Consumer only
+};
+
+} // namespace ionet::core
+
+#endif
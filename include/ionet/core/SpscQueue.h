@@ -0,0 +1,119 @@
+#ifndef IONET_CORE_SPSC_QUEUE_H
+#define IONET_CORE_SPSC_QUEUE_H
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace ionet::core {
+
+/// Alignment that keeps data written by different threads on separate
+/// cache lines (fixed rather than hardware_destructive_interference_size,
+/// which may differ between translation units)
+inline constexpr std::size_t kCacheLine = 64;
+
+namespace detail {
+
+/// Ring capacity rounded up to a power of two
+inline std::size_t ringCapacity(std::size_t capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Queue capacity must be positive");
+    }
+    std::size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    return size;
+}
+
+} // namespace detail
+
+/// Bounded lock-free queue for exactly one producer and one consumer thread.
+///
+/// Slots are constructed once and reused: the producer fills a slot in
+/// place (tryPush with a functor) and the consumer reads it in place
+/// (front/pop), so slots holding vectors keep their capacity and steady
+/// state traffic does not allocate. Capacity is rounded up to a power of two.
+template<typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(std::size_t capacity)
+        : slots_(detail::ringCapacity(capacity))
+        , mask_(slots_.size() - 1)
+    {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    std::size_t capacity() const { return slots_.size(); }
+
+    /// Producer: fill the next free slot with `fill(T&)`; false when full
+    template<typename Fill>
+        requires std::invocable<Fill&, T&>
+    bool tryPush(Fill&& fill) {
+        if (full()) {
+            return false;
+        }
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        fill(slots_[tail & mask_]);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Producer: copy a value into the next free slot; false when full
+    bool tryPush(const T& value) {
+        return tryPush([&](T& slot) { slot = value; });
+    }
+
+    /// Producer: true if tryPush() would fail. Only the producer fills
+    /// slots, so a false answer holds until its next push.
+    bool full() {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - headCache_ == slots_.size()) {
+            headCache_ = head_.load(std::memory_order_acquire);
+        }
+        return tail - headCache_ == slots_.size();
+    }
+
+    /// Consumer: oldest item, or nullptr when empty. Valid until pop().
+    T* front() {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tailCache_) {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head == tailCache_) {
+                return nullptr;
+            }
+        }
+        return &slots_[head & mask_];
+    }
+
+    /// Consumer: release the item returned by front()
+    void pop() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// Approximate number of queued items (exact when both sides are idle)
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    std::vector<T> slots_;
+    const std::size_t mask_;
+
+    // Consumer-owned index plus its cached view of the producer's index
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    std::size_t tailCache_ = 0;
+
+    // Producer-owned index plus its cached view of the consumer's index
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+    std::size_t headCache_ = 0;
+};
+
+} // namespace ionet::core
+
+#endif
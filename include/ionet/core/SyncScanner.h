@@ -0,0 +1,55 @@
+#ifndef IONET_CORE_SYNC_SCANNER_H
+#define IONET_CORE_SYNC_SCANNER_H
+
+#include "ByteBuffer.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace ionet::core {
+
+/// Finds a 1-4 byte sync pattern in a byte stream, e.g. to recover frame
+/// alignment after corruption. The search runs on the SIMD kernels
+/// (kernels::findSync), so scanning a burst of garbage costs a few cycles
+/// per 16/32 bytes instead of a read per byte.
+class SyncScanner {
+public:
+    static constexpr std::size_t kMaxPattern = 4;
+
+    /// Throws std::invalid_argument for an empty or longer than 4 byte pattern
+    explicit SyncScanner(std::span<const uint8_t> pattern);
+
+    std::span<const uint8_t> pattern() const { return {pattern_.data(), length_}; }
+
+    /// Offset of the next match at or after `from`. A match cut off by the
+    /// end of `data` is reported too, since the rest may be in the next
+    /// chunk. Returns data.size() if there is neither. Does not count stats.
+    std::size_t find(std::span<const uint8_t> data, std::size_t from = 0) const;
+
+    /// Advance the reader to the next match, counting the bytes skipped.
+    /// Returns true if a complete pattern starts at the new position; false
+    /// if the reader ran out (it is then left at a cut-off match or the end).
+    bool resync(ByteBufferReader& reader);
+
+    /// Bytes skipped by resync() and record()
+    uint64_t bytesSkipped() const { return bytesSkipped_; }
+
+    /// Number of resync() calls that had to skip anything
+    uint64_t resyncs() const { return resyncs_; }
+
+    /// Count bytes skipped by a caller that used find() directly
+    void record(std::size_t skipped);
+
+    void resetStats();
+
+private:
+    std::array<uint8_t, kMaxPattern> pattern_{};
+    std::size_t length_ = 0;
+    uint64_t bytesSkipped_ = 0;
+    uint64_t resyncs_ = 0;
+};
+
+} // namespace ionet::core
+
+#endif
@@ -1,15 +1,19 @@
 #ifndef IONET_CORE_TYPES_H
 #define IONET_CORE_TYPES_H
 
+#include <algorithm>
 #include <cstdint>
+#include <memory_resource>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <variant>
 
 namespace ionet::core {
 
 /// Supported data types for schema fields
-enum class DataType {
+enum class DataType : uint8_t {
     Int8,
     Int16,
     Int32,
@@ -32,6 +36,40 @@ enum class ByteOrder {
     Native
 };
 
+/// Numeric arrays widened to one element type per kind, as a Value holds them
+using IntArray = std::vector<int64_t>;
+using UIntArray = std::vector<uint64_t>;
+using RealArray = std::vector<double>;
+
+/// Numeric array elements at their declared width, one alternative per
+/// numeric DataType in the same order (Int8 ... Float64). Decoded packets
+/// store arrays this way, so an int16[64] block takes 128 bytes, drawn
+/// from the packet's memory resource.
+using ElementArray = std::variant<
+    std::pmr::vector<int8_t>,
+    std::pmr::vector<int16_t>,
+    std::pmr::vector<int32_t>,
+    std::pmr::vector<int64_t>,
+    std::pmr::vector<uint8_t>,
+    std::pmr::vector<uint16_t>,
+    std::pmr::vector<uint32_t>,
+    std::pmr::vector<uint64_t>,
+    std::pmr::vector<float>,
+    std::pmr::vector<double>
+>;
+
+/// Bytes borrowed from a decoded frame rather than copied out of it
+struct ByteView : std::span<const uint8_t> {
+    using std::span<const uint8_t>::span;
+    
+    ByteView() = default;
+    ByteView(std::span<const uint8_t> bytes) : std::span<const uint8_t>(bytes) {}
+    
+    friend bool operator==(ByteView a, ByteView b) {
+        return std::ranges::equal(a, b);
+    }
+};
+
 /// Universal value type for decoded/encoded fields
 using Value = std::variant<
     std::monostate,           // Empty/unset
@@ -39,9 +77,89 @@ using Value = std::variant<
     uint64_t,                 // All unsigned integers
     double,                   // All floats
     std::string,              // Strings
-    std::vector<uint8_t>      // Raw bytes
+    std::vector<uint8_t>,     // Raw bytes
+    IntArray,                 // Signed integer arrays
+    UIntArray,                // Unsigned integer arrays
+    RealArray,                // Float arrays and scaled arrays
+    std::string_view,         // Strings borrowed from the frame
+    ByteView                  // Raw bytes borrowed from the frame
 >;
 
+/// Numeric value in 16 bytes: a signed, unsigned or floating point
+/// payload plus a tag saying which. Used for decoded scalar fields, where
+/// a full Value would cost 40 bytes.
+class Scalar {
+public:
+    enum class Kind : uint8_t { None, Int, UInt, Real };
+    
+    constexpr Scalar() : u_(0) {}
+    constexpr Scalar(int64_t value) : i_(value), kind_(Kind::Int) {}
+    constexpr Scalar(uint64_t value) : u_(value), kind_(Kind::UInt) {}
+    constexpr Scalar(double value) : d_(value), kind_(Kind::Real) {}
+    
+    /// The numeric alternatives of a Value; None for anything else
+    static Scalar fromValue(const Value& value) {
+        if (const auto* i = std::get_if<int64_t>(&value)) return *i;
+        if (const auto* u = std::get_if<uint64_t>(&value)) return *u;
+        if (const auto* d = std::get_if<double>(&value)) return *d;
+        return {};
+    }
+    
+    constexpr Kind kind() const { return kind_; }
+    constexpr bool empty() const { return kind_ == Kind::None; }
+    
+    /// Stored value, unchecked: the kind must match
+    constexpr int64_t asInt() const { return i_; }
+    constexpr uint64_t asUInt() const { return u_; }
+    constexpr double asReal() const { return d_; }
+    
+    /// Stored value converted to T (0 when empty)
+    template<typename T>
+    constexpr T to() const {
+        switch (kind_) {
+            case Kind::Int:  return static_cast<T>(i_);
+            case Kind::UInt: return static_cast<T>(u_);
+            case Kind::Real: return static_cast<T>(d_);
+            case Kind::None: break;
+        }
+        return T{};
+    }
+    
+    double toDouble() const { return to<double>(); }
+    
+    /// The matching Value alternative (monostate when empty)
+    Value toValue() const {
+        switch (kind_) {
+            case Kind::Int:  return i_;
+            case Kind::UInt: return u_;
+            case Kind::Real: return d_;
+            case Kind::None: break;
+        }
+        return std::monostate{};
+    }
+    
+    friend constexpr bool operator==(const Scalar& a, const Scalar& b) {
+        if (a.kind_ != b.kind_) return false;
+        switch (a.kind_) {
+            case Kind::Int:  return a.i_ == b.i_;
+            case Kind::UInt: return a.u_ == b.u_;
+            case Kind::Real: return a.d_ == b.d_;
+            case Kind::None: break;
+        }
+        return true;
+    }
+
+private:
+    union {
+        int64_t i_;
+        uint64_t u_;
+        double d_;
+    };
+    Kind kind_ = Kind::None;
+};
+
+static_assert(sizeof(Scalar) == 16);
+
 /// Get size in bytes for a data type
 constexpr std::size_t dataTypeSize(DataType type) {
     switch (type) {
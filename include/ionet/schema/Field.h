@@ -1,8 +1,15 @@
 #ifndef IONET_SCHEMA_FIELD_H
 #define IONET_SCHEMA_FIELD_H
 
+#include "../core/Checked.h"
 #include "../core/Types.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include <optional>
 
@@ -15,17 +22,213 @@ struct BitFlag {
     std::string description;
 };
 
+/// Name for one value of an enumerated subfield
+struct EnumLabel {
+    uint64_t value = 0;
+    std::string name;
+};
+
+/// Decimal fixed-point number: mantissa * 10^exponent
+struct FixedPoint {
+    int64_t mantissa = 0;
+    int8_t exponent = 0;
+    
+    double toDouble() const {
+        // Dividing keeps values such as 2550e-2 exact
+        double power = std::pow(10.0, std::abs(exponent));
+        return exponent < 0 ? static_cast<double>(mantissa) / power
+                            : static_cast<double>(mantissa) * power;
+    }
+    
+    bool operator==(const FixedPoint&) const = default;
+};
+
+/// Scaling carried out in integers: fixed = raw * multiplier + bias, in
+/// units of 10^exponent. Exact; nullopt where the result would not fit
+/// in int64.
+struct FixedScaling {
+    int64_t multiplier = 1;
+    int64_t bias = 0;
+    int8_t exponent = 0;
+    
+    std::optional<FixedPoint> apply(int64_t raw) const {
+        int64_t mantissa = 0;
+        if (!core::checked::mul(raw, multiplier, mantissa) ||
+            !core::checked::add(mantissa, bias, mantissa)) {
+            return std::nullopt;
+        }
+        return FixedPoint{mantissa, exponent};
+    }
+    
+    /// Smallest and largest raw values apply() takes without overflowing
+    std::pair<int64_t, int64_t> rawRange() const {
+        constexpr auto max = std::numeric_limits<int64_t>::max();
+        constexpr auto min = std::numeric_limits<int64_t>::min();
+        
+        // raw * multiplier must fit, and still fit once bias is added
+        const int64_t low = bias > 0 ? min : min - bias;
+        const int64_t high = bias < 0 ? max : max - bias;
+        if (multiplier > 0) {
+            return {ceilDivide(low, multiplier), floorDivide(high, multiplier)};
+        }
+        if (multiplier == -1) {
+            return {-high, low == min ? max : -low};
+        }
+        if (multiplier < 0) {
+            return {ceilDivide(high, multiplier), floorDivide(low, multiplier)};
+        }
+        return {min, max};
+    }
+    
+    /// Raw value behind a fixed-point number, rounded to the nearest
+    /// integer; exact for anything apply() produced, nullopt if the
+    /// arithmetic would overflow int64
+    std::optional<int64_t> remove(const FixedPoint& value) const {
+        int64_t mantissa = value.mantissa;
+        for (int e = value.exponent; e > exponent; --e) {
+            if (!core::checked::mul(mantissa, 10, mantissa)) {
+                return std::nullopt;
+            }
+        }
+        int64_t divisor = multiplier;
+        int64_t factor = 1;
+        for (int e = value.exponent; e < exponent; ++e) {
+            if (!core::checked::mul(divisor, 10, divisor) ||
+                !core::checked::mul(factor, 10, factor)) {
+                return std::nullopt;
+            }
+        }
+        int64_t shift = 0;
+        if (!core::checked::mul(bias, factor, shift) ||
+            !core::checked::sub(mantissa, shift, mantissa)) {
+            return std::nullopt;
+        }
+        return roundedDivide(mantissa, divisor);
+    }
+    
+    bool operator==(const FixedScaling&) const = default;
+
+private:
+    static int64_t floorDivide(int64_t n, int64_t d) {
+        const int64_t quotient = n / d;
+        return (n % d != 0 && (n < 0) != (d < 0)) ? quotient - 1 : quotient;
+    }
+    
+    static int64_t ceilDivide(int64_t n, int64_t d) {
+        const int64_t quotient = n / d;
+        return (n % d != 0 && (n < 0) == (d < 0)) ? quotient + 1 : quotient;
+    }
+    
+    // Halves round away from zero
+    static std::optional<int64_t> roundedDivide(int64_t n, int64_t d) {
+        if (d == -1) {
+            int64_t negated = 0;
+            if (!core::checked::sub(0, n, negated)) {
+                return std::nullopt;
+            }
+            return negated;
+        }
+        int64_t quotient = n / d;
+        int64_t remainder = n % d;
+        auto magnitude = [](int64_t v) {
+            return v < 0 ? uint64_t{0} - static_cast<uint64_t>(v) : static_cast<uint64_t>(v);
+        };
+        if (magnitude(remainder) >= magnitude(d) - magnitude(remainder)) {
+            quotient += (n < 0) != (d < 0) ? -1 : 1;
+        }
+        return quotient;
+    }
+};
+
 /// Scaling parameters for integer-to-real conversion
 struct Scaling {
     double scale = 1.0;   // Multiplier
     double offset = 0.0;  // Added after scaling
     
+    /// Decimal places tried when looking for a fixed-point form
+    static constexpr int kMaxFixedDigits = 15;
+    
     double apply(int64_t raw) const {
         return (static_cast<double>(raw) * scale) + offset;
     }
     
+    /// Raw value for a real one, rounded to the nearest integer so that
+    /// remove(apply(raw)) == raw
     int64_t remove(double real) const {
-        return static_cast<int64_t>((real - offset) / scale);
+        return std::llround((real - offset) / scale);
+    }
+    
+    /// The same scaling in integers, at the fewest decimal places that
+    /// hold both scale and offset exactly (e.g. 0.01 / -40 becomes
+    /// 1 / -4000 at exponent -2); nullopt if there is none, as for 1/3.
+    /// Searched for on every call; a Schema resolves it once per field,
+    /// into Field::fixedScaling.
+    std::optional<FixedScaling> fixed() const {
+        double power = 1.0;
+        for (int digits = 0; digits <= kMaxFixedDigits; ++digits, power *= 10.0) {
+            double multiplier = std::round(scale * power);
+            double bias = std::round(offset * power);
+            if (isWhole(scale * power, multiplier) && isWhole(offset * power, bias)) {
+                if (multiplier == 0.0) {
+                    return std::nullopt;
+                }
+                return FixedScaling{
+                    static_cast<int64_t>(multiplier),
+                    static_cast<int64_t>(bias),
+                    static_cast<int8_t>(-digits)
+                };
+            }
+        }
+        return std::nullopt;
+    }
+    
+    /// Raw value for a fixed-point one; exact for anything fixed()->apply()
+    /// produced, and through remove(double) when there is no fixed form
+    /// or the integer form overflows. Searches for fixed() each time;
+    /// Field::rawFromFixed uses the form the schema resolved.
+    int64_t remove(const FixedPoint& value) const {
+        if (auto integer = fixed()) {
+            if (auto raw = integer->remove(value)) {
+                return *raw;
+            }
+        }
+        return remove(value.toDouble());
+    }
+
+private:
+    // Decimal inputs such as 0.01 are off by a few ulps once multiplied
+    // out; the magnitude cap keeps a few ulps well below a fraction
+    static bool isWhole(double value, double rounded) {
+        constexpr double ulps = 4 * std::numeric_limits<double>::epsilon();
+        return std::abs(rounded) < 1.0e12 &&
+            std::abs(value - rounded) <= ulps * std::max(1.0, std::abs(value));
+    }
+};
+
+/// Unsigned value packed into a run of bits within a bitfield
+struct BitSubfield {
+    uint8_t bit = 0;                // Lowest bit (0-63)
+    uint8_t width = 1;              // Bits (1-64)
+    std::string name;
+    std::string description;
+    std::optional<Scaling> scaling;
+    std::optional<std::string> unit;
+    std::vector<EnumLabel> labels;  // Names for enumerated values
+    
+    /// Bits of the raw bitfield holding this subfield
+    uint64_t mask() const {
+        uint64_t bits = width >= 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+        return bits << bit;
+    }
+    
+    /// Name for an enumerated value, or nullptr
+    const std::string* label(uint64_t value) const {
+        for (const auto& entry : labels) {
+            if (entry.value == value) {
+                return &entry.name;
+            }
+        }
+        return nullptr;
     }
 };
 
@@ -44,10 +247,11 @@ struct Field {
     // Size info
     std::optional<std::size_t> arraySize;    // For arrays
     std::optional<std::size_t> stringSize;   // For fixed-length strings
-    std::optional<uint8_t> bitCount;         // For bitfields (1-64)
+    std::optional<uint8_t> bitCount;         // For bitfields and bit-packed integers (1-64)
     
     // Interpretation
     std::optional<Scaling> scaling;
+    std::optional<FixedScaling> fixedScaling;  // `scaling` in integers, set by Schema::addPacket
     std::optional<std::string> unit;
     std::string description;
     
@@ -57,6 +261,18 @@ struct Field {
     // Validation
     Constraints constraints;
     
+    // Multi-bit values within a bitfield
+    std::vector<BitSubfield> subfields;
+    
+    // Bit-packed integers: absolute bit position in the packet
+    // (default: right after the previous field)
+    std::optional<std::size_t> bitOffset;
+    
+    // Variable-length strings, bytes and arrays: earlier integer field that
+    // holds the length (characters, bytes or elements). stringSize/arraySize
+    // then give the largest length accepted, if set.
+    std::optional<std::string> lengthField;
+    
     /// Calculate byte size of this field
     std::size_t byteSize() const {
         if (arraySize) {
@@ -73,18 +289,68 @@ struct Field {
     
     /// Check if field has fixed size
     bool isFixedSize() const {
+        if (lengthField) {
+            return false;
+        }
         return type != core::DataType::String || stringSize.has_value();
     }
     
+    /// Check if this is an array of numbers (arraySize elements, or as many
+    /// as the length field says)
+    bool isArray() const {
+        return (arraySize.has_value() || lengthField.has_value()) && core::isNumeric(type);
+    }
+    
+    /// Check if the length comes from an earlier field
+    bool isVariableLength() const {
+        return lengthField.has_value();
+    }
+    
+    /// Check if this is an integer packed into `bitCount` bits with no byte alignment
+    bool isBitPacked() const {
+        return bitCount.has_value() && core::isInteger(type);
+    }
+    
     /// Check if this is a bitfield
     bool isBitfield() const {
-        return type == core::DataType::Bitfield || !bitFlags.empty();
+        return type == core::DataType::Bitfield || !bitFlags.empty() || !subfields.empty();
+    }
+    
+    /// Resolve a flag name to its mask within the raw bitfield value
+    std::optional<uint64_t> flagMask(std::string_view flagName) const {
+        for (const auto& flag : bitFlags) {
+            if (flag.name == flagName) {
+                return uint64_t{1} << flag.bit;
+            }
+        }
+        return std::nullopt;
+    }
+    
+    /// Position of a subfield in `subfields`, or -1 if there is none
+    int subfieldIndex(std::string_view subfieldName) const {
+        for (std::size_t i = 0; i < subfields.size(); ++i) {
+            if (subfields[i].name == subfieldName) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
     }
     
     /// Check if scaling should be applied
     bool hasScaling() const {
         return scaling.has_value();
     }
+    
+    /// Raw value for a fixed-point one, through fixedScaling where the
+    /// schema resolved one and through the scaling's double form otherwise
+    int64_t rawFromFixed(const FixedPoint& value) const {
+        if (fixedScaling) {
+            if (auto raw = fixedScaling->remove(value)) {
+                return *raw;
+            }
+        }
+        return scaling.value_or(Scaling{}).remove(value.toDouble());
+    }
 };
 
 } // namespace ionet::schema
@@ -0,0 +1,45 @@
+#ifndef IONET_SCHEMA_FRAME_HEADER_H
+#define IONET_SCHEMA_FRAME_HEADER_H
+
+#include "../core/Types.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ionet::schema {
+
+/// Integer field inside a frame header
+struct HeaderField {
+    std::size_t offset = 0;                         // From the start of the frame
+    core::DataType type = core::DataType::UInt8;    // Unsigned integer type
+
+    std::size_t end() const { return offset + core::dataTypeSize(type); }
+};
+
+/// Layout of the header that precedes every packet on a byte stream.
+/// A frame is `size` header bytes followed by the packet payload.
+struct FrameHeader {
+    std::vector<uint8_t> sync;            // Sync word at offset 0 (may be empty)
+    HeaderField id;                       // Packet ID
+    std::optional<HeaderField> length;    // Payload length; without it the packet must be fixed size
+    int64_t lengthAdjust = 0;             // Added to the length value to get payload bytes
+    std::size_t size = 0;                 // Header bytes before the payload
+
+    /// Check that every field fits inside the header
+    bool validate(std::string* errorOut = nullptr) const {
+        if (sync.size() > size || id.end() > size || (length && length->end() > size)) {
+            if (errorOut) *errorOut = "Frame header fields exceed header size";
+            return false;
+        }
+        if (!core::isUnsigned(id.type) || (length && !core::isUnsigned(length->type))) {
+            if (errorOut) *errorOut = "Frame header id/length must be unsigned integers";
+            return false;
+        }
+        return true;
+    }
+};
+
+} // namespace ionet::schema
+
+#endif
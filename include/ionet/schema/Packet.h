@@ -9,6 +9,15 @@
 
 namespace ionet::schema {
 
+/// Stable reference to a field of a packet, resolved once from names.
+/// Indexes decoded data directly instead of hashing the field name.
+struct FieldHandle {
+    uint32_t packetId = 0;
+    uint32_t index = 0;                   // Position in Packet::fields
+    
+    bool operator==(const FieldHandle&) const = default;
+};
+
 /// Definition of a packet structure
 struct Packet {
     uint32_t id = 0;                      // Packet identifier
@@ -47,6 +56,15 @@ struct Packet {
         }
         return -1;
     }
+    
+    /// Resolve a field name to a handle
+    std::optional<FieldHandle> handle(const std::string& name) const {
+        int index = fieldIndex(name);
+        if (index < 0) {
+            return std::nullopt;
+        }
+        return FieldHandle{id, static_cast<uint32_t>(index)};
+    }
 };
 
 } // namespace ionet::schema
@@ -2,9 +2,14 @@
 #define IONET_SCHEMA_SCHEMA_H
 
 #include "Packet.h"
+#include "FrameHeader.h"
+#include "StringTable.h"
 #include "../core/Types.h"
 #include <string>
+#include <string_view>
+#include <deque>
 #include <vector>
+#include <optional>
 #include <unordered_map>
 
 namespace ionet::schema {
@@ -16,11 +21,46 @@ struct SchemaInfo {
     std::string description;
 };
 
-/// Complete schema definition
+/// Names of one packet interned in its schema's string table, so
+/// decoded data can refer to them and look fields up without allocating
+struct PacketNames {
+    std::string_view packet;
+    std::unordered_map<std::string_view, uint32_t> fields;  // Name -> position in Packet::fields
+    
+    /// Position of a field in Packet::fields, or -1
+    int find(std::string_view name) const {
+        auto it = fields.find(name);
+        return it != fields.end() ? static_cast<int>(it->second) : -1;
+    }
+};
+
+/// Complete schema definition.
+/// Packet and field names are interned once as packets are added; moving
+/// a schema keeps them in place, a copy interns its own.
 class Schema {
 public:
     Schema() = default;
     
+    Schema(const Schema& other)
+        : info_(other.info_)
+        , byteOrder_(other.byteOrder_)
+        , frameHeader_(other.frameHeader_)
+    {
+        for (const auto& packet : other.packets_) {
+            addPacket(packet);
+        }
+    }
+    
+    Schema& operator=(const Schema& other) {
+        if (this != &other) {
+            *this = Schema(other);
+        }
+        return *this;
+    }
+    
+    Schema(Schema&&) = default;
+    Schema& operator=(Schema&&) = default;
+    
     // Metadata
     void setInfo(SchemaInfo info) { info_ = std::move(info); }
     const SchemaInfo& info() const { return info_; }
@@ -29,17 +69,49 @@ public:
     void setByteOrder(core::ByteOrder order) { byteOrder_ = order; }
     core::ByteOrder byteOrder() const { return byteOrder_; }
     
-    // Packet management
+    // Stream framing (optional)
+    void setFrameHeader(FrameHeader header) { frameHeader_ = std::move(header); }
+    const std::optional<FrameHeader>& frameHeader() const { return frameHeader_; }
+    
+    /// Add a packet. Packets already added stay at the same address, so
+    /// decode plans and decoded data that refer to them remain valid; a
+    /// Decoder picks the new packet up on its next call. Not safe while
+    /// another thread decodes against this schema.
     void addPacket(Packet packet) {
         uint32_t id = packet.id;
         std::string name = packet.name;
+        
+        // Fixed-point forms are searched for once, here, not per value
+        for (auto& field : packet.fields) {
+            field.fixedScaling = field.scaling && core::isInteger(field.type)
+                ? field.scaling->fixed()
+                : std::nullopt;
+        }
         packets_.push_back(std::move(packet));
         idIndex_[id] = packets_.size() - 1;
         nameIndex_[name] = packets_.size() - 1;
+        
+        // The first field of a duplicated name wins, as in Packet::fieldIndex
+        const auto& added = packets_.back();
+        PacketNames names;
+        names.packet = strings_.intern(added.name);
+        for (std::size_t i = 0; i < added.fields.size(); ++i) {
+            names.fields.emplace(strings_.intern(added.fields[i].name), static_cast<uint32_t>(i));
+        }
+        names_.push_back(std::move(names));
     }
     
+    /// Interned names of a packet, or nullptr for an unknown ID
+    const PacketNames* packetNames(uint32_t id) const {
+        auto it = idIndex_.find(id);
+        return it != idIndex_.end() ? &names_[it->second] : nullptr;
+    }
+    
+    /// Every packet and field name in the schema, stored once
+    const StringTable& strings() const { return strings_; }
+    
     /// Get all packets
-    const std::vector<Packet>& packets() const { return packets_; }
+    const std::deque<Packet>& packets() const { return packets_; }
     
     /// Find packet by ID
     const Packet* findPacketById(uint32_t id) const {
@@ -59,6 +131,17 @@ public:
         return nullptr;
     }
     
+    /// Resolve a field of a packet to a handle
+    std::optional<FieldHandle> fieldHandle(uint32_t packetId, const std::string& fieldName) const {
+        const auto* packet = findPacketById(packetId);
+        return packet ? packet->handle(fieldName) : std::nullopt;
+    }
+    
+    std::optional<FieldHandle> fieldHandle(const std::string& packetName, const std::string& fieldName) const {
+        const auto* packet = findPacketByName(packetName);
+        return packet ? packet->handle(fieldName) : std::nullopt;
+    }
+    
     /// Check if schema has any packets
     bool empty() const { return packets_.empty(); }
     
@@ -87,15 +170,77 @@ public:
             }
         }
         
+        // Check subfields lie within their bitfield and packed integers fit their type
+        for (const auto& packet : packets_) {
+            for (const auto& field : packet.fields) {
+                if (field.isBitPacked() &&
+                    (*field.bitCount == 0 || *field.bitCount > core::dataTypeSize(field.type) * 8)) {
+                    if (errorOut) {
+                        *errorOut = "Field '" + field.name + "' cannot pack " +
+                            std::to_string(*field.bitCount) + " bits into " + core::dataTypeToString(field.type);
+                    }
+                    return false;
+                }
+                if (field.isBitPacked() && field.arraySize) {
+                    if (errorOut) *errorOut = "Field '" + field.name + "' cannot be both bit-packed and an array";
+                    return false;
+                }
+                if (field.bitOffset && !field.isBitPacked()) {
+                    if (errorOut) *errorOut = "Field '" + field.name + "' has a bit offset but is not bit-packed";
+                    return false;
+                }
+                std::size_t bits = field.bitCount ? *field.bitCount : field.byteSize() * 8;
+                for (const auto& sub : field.subfields) {
+                    if (sub.width == 0 || sub.bit + sub.width > bits || bits > 64) {
+                        if (errorOut) {
+                            *errorOut = "Subfield '" + sub.name + "' of field '" + field.name +
+                                "' does not fit in " + std::to_string(bits) + " bits";
+                        }
+                        return false;
+                    }
+                }
+            }
+        }
+        
+        // Check variable-length fields take their length from an earlier integer
+        for (const auto& packet : packets_) {
+            for (std::size_t i = 0; i < packet.fields.size(); ++i) {
+                const auto& field = packet.fields[i];
+                if (!field.lengthField) {
+                    continue;
+                }
+                if (field.isBitPacked() || field.isBitfield()) {
+                    if (errorOut) *errorOut = "Field '" + field.name + "' cannot have a variable length";
+                    return false;
+                }
+                int source = packet.fieldIndex(*field.lengthField);
+                if (source < 0 || static_cast<std::size_t>(source) >= i ||
+                    !core::isInteger(packet.fields[source].type) || packet.fields[source].isArray()) {
+                    if (errorOut) {
+                        *errorOut = "Field '" + field.name + "' takes its length from '" +
+                            *field.lengthField + "', which is not an earlier integer field";
+                    }
+                    return false;
+                }
+            }
+        }
+        
+        if (frameHeader_ && !frameHeader_->validate(errorOut)) {
+            return false;
+        }
+        
         return true;
     }
 
 private:
     SchemaInfo info_;
     core::ByteOrder byteOrder_ = core::ByteOrder::Big;
-    std::vector<Packet> packets_;
+    std::optional<FrameHeader> frameHeader_;
+    std::deque<Packet> packets_;            // Stable addresses as packets are added
     std::unordered_map<uint32_t, std::size_t> idIndex_;
     std::unordered_map<std::string, std::size_t> nameIndex_;
+    StringTable strings_;
+    std::deque<PacketNames> names_;         // Parallel to packets_; stable for decoded packets
 };
 
 } // namespace ionet::schema
@@ -39,6 +39,12 @@ public:
         return *this;
     }
     
+    /// Declare the header that frames packets on a byte stream
+    SchemaBuilder& frameHeader(FrameHeader header) {
+        frameHeader_ = std::move(header);
+        return *this;
+    }
+    
     /// Start defining a new packet
     SchemaBuilder& packet(uint32_t id, std::string name) {
         finishCurrentPacket();
@@ -64,6 +70,13 @@ public:
         return *this;
     }
     
+    /// Add a fixed-length array of `count` numeric elements
+    SchemaBuilder& array(std::string name, core::DataType type, std::size_t count) {
+        field(std::move(name), type);
+        currentPacket_->fields.back().arraySize = count;
+        return *this;
+    }
+    
     /// Shorthand field methods
     SchemaBuilder& uint8(std::string name) { return field(std::move(name), core::DataType::UInt8); }
     SchemaBuilder& uint16(std::string name) { return field(std::move(name), core::DataType::UInt16); }
@@ -99,6 +112,27 @@ public:
         return *this;
     }
     
+    /// Pack last (integer) field into `count` bits, MSB-first, right after
+    /// the previous field or at an explicit bit position in the packet
+    SchemaBuilder& bits(uint8_t count, std::optional<std::size_t> bitOffset = std::nullopt) {
+        ensureField();
+        auto& f = currentPacket_->fields.back();
+        if (!core::isInteger(f.type)) {
+            throw std::logic_error("bits() can only be called after an integer field");
+        }
+        f.bitCount = count;
+        f.bitOffset = bitOffset;
+        return *this;
+    }
+    
+    /// Take the last (string, bytes or numeric) field's length from an
+    /// earlier integer field: characters, bytes or array elements
+    SchemaBuilder& lengthFrom(std::string fieldName) {
+        ensureField();
+        currentPacket_->fields.back().lengthField = std::move(fieldName);
+        return *this;
+    }
+    
     /// Add unit to last field
     SchemaBuilder& unit(std::string u) {
         ensureField();
@@ -135,6 +169,34 @@ public:
         return *this;
     }
     
+    /// Add a multi-bit subfield (`width` bits from `bit`) to last bitfield
+    SchemaBuilder& subfield(uint8_t bit, uint8_t width, std::string name, std::string desc = "") {
+        ensureField();
+        auto& f = currentPacket_->fields.back();
+        if (f.type != core::DataType::Bitfield) {
+            throw std::logic_error("subfield() can only be called after bitfield()");
+        }
+        BitSubfield sub;
+        sub.bit = bit;
+        sub.width = width;
+        sub.name = std::move(name);
+        sub.description = std::move(desc);
+        f.subfields.push_back(std::move(sub));
+        return *this;
+    }
+    
+    /// Set scaling on last subfield
+    SchemaBuilder& subfieldScaled(double scale, double offset = 0.0) {
+        lastSubfield().scaling = Scaling{scale, offset};
+        return *this;
+    }
+    
+    /// Name a value of last subfield
+    SchemaBuilder& label(uint64_t value, std::string name) {
+        lastSubfield().labels.push_back(EnumLabel{value, std::move(name)});
+        return *this;
+    }
+    
     /// Add a string field
     SchemaBuilder& string(std::string name, std::size_t size) {
         ensurePacket();
@@ -158,6 +220,9 @@ public:
         Schema schema;
         schema.setInfo(std::move(info_));
         schema.setByteOrder(byteOrder_);
+        if (frameHeader_) {
+            schema.setFrameHeader(std::move(*frameHeader_));
+        }
         
         for (auto& packet : packets_) {
             schema.addPacket(std::move(packet));
@@ -180,6 +245,15 @@ private:
         }
     }
     
+    BitSubfield& lastSubfield() {
+        ensureField();
+        auto& f = currentPacket_->fields.back();
+        if (f.subfields.empty()) {
+            throw std::logic_error("No subfield defined. Call subfield() first.");
+        }
+        return f.subfields.back();
+    }
+    
     void finishCurrentPacket() {
         if (currentPacket_) {
             packets_.push_back(std::move(*currentPacket_));
@@ -189,6 +263,7 @@ private:
     
     SchemaInfo info_;
     core::ByteOrder byteOrder_ = core::ByteOrder::Big;
+    std::optional<FrameHeader> frameHeader_;
     std::vector<Packet> packets_;
     std::optional<Packet> currentPacket_;
 };
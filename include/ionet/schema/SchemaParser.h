@@ -45,6 +45,21 @@ struct IRScaling {
     std::optional<double> offset;
 };
 
+struct IREnumLabel {
+    uint64_t value = 0;
+    std::string name;
+};
+
+struct IRSubfield {
+    uint8_t bit = 0;
+    uint8_t width = 1;
+    std::string name;
+    std::string description;
+    std::string unit;
+    IRScaling scaling;
+    std::vector<IREnumLabel> labels;
+};
+
 struct IRConstraints {
     std::optional<double> min;
     std::optional<double> max;
@@ -58,8 +73,11 @@ struct IRField {
     IRScaling scaling;
     IRConstraints constraints;
     std::optional<uint8_t> bitCount;
+    std::optional<std::size_t> bitOffset;
     std::vector<IRBitFlag> bitFlags;
+    std::vector<IRSubfield> subfields;
     std::optional<std::size_t> size;
+    std::optional<std::string> lengthField;
 };
 
 struct IRPacket {
@@ -69,6 +87,19 @@ struct IRPacket {
     std::vector<IRField> fields;
 };
 
+struct IRHeaderField {
+    std::size_t offset = 0;
+    std::string type;
+};
+
+struct IRFrameHeader {
+    std::vector<uint8_t> sync;
+    IRHeaderField id;
+    std::optional<IRHeaderField> length;
+    int64_t lengthAdjust = 0;
+    std::optional<std::size_t> size;    // Defaults to the end of the last header field
+};
+
 struct IRSchemaInfo {
     std::string name;
     std::string version;
@@ -78,6 +109,7 @@ struct IRSchemaInfo {
 
 struct IRSchema {
     IRSchemaInfo info;
+    std::optional<IRFrameHeader> frame;
     std::vector<IRPacket> packets;
 };
 
@@ -100,6 +132,9 @@ protected:
     
     /// Build Packet from IR
     Packet buildPacket(const ir::IRPacket& irPacket);
+    
+    /// Build FrameHeader from IR
+    FrameHeader buildFrameHeader(const ir::IRFrameHeader& irFrame);
 };
 
 /// YAML schema parser
@@ -0,0 +1,64 @@
+#ifndef IONET_SCHEMA_STRING_TABLE_H
+#define IONET_SCHEMA_STRING_TABLE_H
+
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace ionet::schema {
+
+/// Strings stored once each. intern() hands out std::string_views that
+/// stay valid for the table's lifetime, also when the table is moved;
+/// a copy interns its own strings.
+class StringTable {
+public:
+    StringTable() = default;
+
+    StringTable(const StringTable& other) {
+        for (const auto& text : other.storage_) {
+            intern(text);
+        }
+    }
+
+    StringTable& operator=(const StringTable& other) {
+        if (this != &other) {
+            *this = StringTable(other);
+        }
+        return *this;
+    }
+
+    StringTable(StringTable&&) = default;
+    StringTable& operator=(StringTable&&) = default;
+
+    /// The stored copy of `text`, added on first use
+    std::string_view intern(std::string_view text) {
+        auto it = index_.find(text);
+        if (it != index_.end()) {
+            return *it;
+        }
+        const auto& stored = storage_.emplace_back(text);
+        return *index_.insert(std::string_view(stored)).first;
+    }
+
+    /// The stored copy of `text`, if it was interned
+    std::optional<std::string_view> find(std::string_view text) const {
+        auto it = index_.find(text);
+        if (it == index_.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    /// Number of distinct strings
+    std::size_t size() const { return storage_.size(); }
+
+private:
+    std::deque<std::string> storage_;                 // Elements never move
+    std::unordered_set<std::string_view> index_;      // Views into storage_
+};
+
+} // namespace ionet::schema
+
+#endif
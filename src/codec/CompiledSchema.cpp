@@ -0,0 +1,376 @@
+#include "../../include/ionet/codec/CompiledSchema.h"
+#include "../../include/ionet/core/Endian.h"
+#include "../../include/ionet/core/Kernels.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace ionet::codec {
+
+namespace {
+
+using core::endian::loadSwapped;
+
+/// Bytes the decoder reads for a field, 0 if not known up front
+std::size_t readWidth(const schema::Field& field) {
+    switch (field.type) {
+        case core::DataType::Bitfield: {
+            uint8_t bitCount = field.bitCount.value_or(8);
+            if (bitCount <= 8)  return 1;
+            if (bitCount <= 16) return 2;
+            if (bitCount <= 32) return 4;
+            return 8;
+        }
+        case core::DataType::String:
+            return field.stringSize.value_or(0);
+        case core::DataType::Bytes:
+            return field.arraySize.value_or(0);
+        default:
+            return field.arraySize.value_or(1) * core::dataTypeSize(field.type);
+    }
+}
+
+/// Packed bits as a raw value, sign-extended for signed types
+core::Scalar packedValue(const FieldPlan& plan, uint64_t bits) {
+    if (core::isSigned(plan.type)) {
+        return core::signExtend(bits, plan.bitWidth);
+    }
+    return bits;
+}
+
+/// The `Array` alternative of `out` sized to `count`, keeping its capacity
+template<typename Array>
+Array& arrayIn(core::Value& out, std::size_t count) {
+    auto* array = std::get_if<Array>(&out);
+    if (!array) {
+        array = &out.emplace<Array>();
+    }
+    array->resize(count);
+    return *array;
+}
+
+/// DataType of an ElementArray alternative's elements
+template<typename T>
+constexpr core::DataType elementType() {
+    if constexpr (std::is_same_v<T, int8_t>) return core::DataType::Int8;
+    else if constexpr (std::is_same_v<T, int16_t>) return core::DataType::Int16;
+    else if constexpr (std::is_same_v<T, int32_t>) return core::DataType::Int32;
+    else if constexpr (std::is_same_v<T, int64_t>) return core::DataType::Int64;
+    else if constexpr (std::is_same_v<T, uint8_t>) return core::DataType::UInt8;
+    else if constexpr (std::is_same_v<T, uint16_t>) return core::DataType::UInt16;
+    else if constexpr (std::is_same_v<T, uint32_t>) return core::DataType::UInt32;
+    else if constexpr (std::is_same_v<T, uint64_t>) return core::DataType::UInt64;
+    else if constexpr (std::is_same_v<T, float>) return core::DataType::Float32;
+    else return core::DataType::Float64;
+}
+
+/// Packed elements into the std::pmr::vector<T> alternative of `out`,
+/// byte swapped to host order in bulk. A new alternative takes the memory
+/// resource of the one it replaces.
+template<typename T>
+void copyElements(const uint8_t* src, std::size_t count, core::ByteOrder order, core::ElementArray& out) {
+    auto* array = std::get_if<std::pmr::vector<T>>(&out);
+    if (!array) {
+        auto* resource = std::visit([](const auto& old) { return old.get_allocator().resource(); }, out);
+        array = &out.emplace<std::pmr::vector<T>>(resource);
+    }
+    array->resize(count);
+    auto* dst = reinterpret_cast<uint8_t*>(array->data());
+    if (sizeof(T) == 1 || !core::endian::needsSwap(order)) {
+        if (count) {
+            std::memcpy(dst, src, count * sizeof(T));
+        }
+    } else if constexpr (sizeof(T) == 2) {
+        core::kernels::byteSwap16(src, dst, count);
+    } else if constexpr (sizeof(T) == 4) {
+        core::kernels::byteSwap32(src, dst, count);
+    } else if constexpr (sizeof(T) == 8) {
+        core::kernels::byteSwap64(src, dst, count);
+    }
+}
+
+/// Convert `count` packed elements of a numeric type in bulk into the
+/// matching array alternative of `out`
+void readArray(
+    core::DataType type,
+    const uint8_t* src,
+    std::size_t count,
+    core::ByteOrder order,
+    core::Value& out
+) {
+    if (core::isSigned(type)) {
+        core::kernels::toInt64(type, src, count, order, arrayIn<core::IntArray>(out, count).data());
+    } else if (core::isUnsigned(type)) {
+        core::kernels::toUInt64(type, src, count, order, arrayIn<core::UIntArray>(out, count).data());
+    } else {
+        core::kernels::toDouble(type, src, count, order, arrayIn<core::RealArray>(out, count).data());
+    }
+}
+
+/// Scale every element of a numeric array into a RealArray in `out`.
+/// Returns false (leaving `out` alone) if `raw` is not an array.
+bool scaleArray(const core::Value& raw, double scale, double offset, core::Value& out) {
+    if (const auto* ints = std::get_if<core::IntArray>(&raw)) {
+        auto& scaled = arrayIn<core::RealArray>(out, ints->size());
+        core::kernels::scale(ints->data(), ints->size(), scale, offset, scaled.data());
+    } else if (const auto* uints = std::get_if<core::UIntArray>(&raw)) {
+        auto& scaled = arrayIn<core::RealArray>(out, uints->size());
+        core::kernels::scale(uints->data(), uints->size(), scale, offset, scaled.data());
+    } else if (const auto* reals = std::get_if<core::RealArray>(&raw)) {
+        auto& scaled = arrayIn<core::RealArray>(out, reals->size());
+        core::kernels::scale(reals->data(), reals->size(), scale, offset, scaled.data());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+void readElements(
+    core::DataType type,
+    const uint8_t* src,
+    std::size_t count,
+    core::ByteOrder order,
+    core::ElementArray& out
+) {
+    switch (type) {
+        case core::DataType::Int8:    copyElements<int8_t>(src, count, order, out); break;
+        case core::DataType::Int16:   copyElements<int16_t>(src, count, order, out); break;
+        case core::DataType::Int32:   copyElements<int32_t>(src, count, order, out); break;
+        case core::DataType::Int64:   copyElements<int64_t>(src, count, order, out); break;
+        case core::DataType::UInt8:   copyElements<uint8_t>(src, count, order, out); break;
+        case core::DataType::UInt16:  copyElements<uint16_t>(src, count, order, out); break;
+        case core::DataType::UInt32:  copyElements<uint32_t>(src, count, order, out); break;
+        case core::DataType::UInt64:  copyElements<uint64_t>(src, count, order, out); break;
+        case core::DataType::Float32: copyElements<float>(src, count, order, out); break;
+        case core::DataType::Float64: copyElements<double>(src, count, order, out); break;
+        default: break;
+    }
+}
+
+void scaleElements(const core::ElementArray& elements, double scale, double offset, std::pmr::vector<double>& out) {
+    // Host-order elements go through the same narrow-width kernels as frames
+    std::visit([&](const auto& array) {
+        using T = typename std::decay_t<decltype(array)>::value_type;
+        out.resize(array.size());
+        core::kernels::toScaled(elementType<T>(), reinterpret_cast<const uint8_t*>(array.data()),
+                                array.size(), core::ByteOrder::Native, scale, offset, out.data());
+    }, elements);
+}
+
+core::Value widenElements(const core::ElementArray& elements) {
+    return std::visit([](const auto& array) -> core::Value {
+        using T = typename std::decay_t<decltype(array)>::value_type;
+        if constexpr (std::is_floating_point_v<T>) {
+            return core::RealArray(array.begin(), array.end());
+        } else if constexpr (std::is_signed_v<T>) {
+            return core::IntArray(array.begin(), array.end());
+        } else {
+            return core::UIntArray(array.begin(), array.end());
+        }
+    }, elements);
+}
+
+core::Scalar readPacked(const FieldPlan& plan, core::BitReader& bits) {
+    if (bits.position() != plan.bitOffset) {
+        bits.seek(plan.bitOffset);
+    }
+    return packedValue(plan, bits.read(plan.bitWidth));
+}
+
+core::Scalar readScalar(const FieldPlan& plan, const uint8_t* frame) {
+    const uint8_t* src = frame + plan.offset;
+    
+    if (plan.count) {
+        return {};
+    }
+    if (plan.bitWidth) {
+        // Only the bytes this field touches
+        core::BitReader bits(std::span<const uint8_t>(src, plan.width), plan.bitOffset % 8);
+        return packedValue(plan, bits.read(plan.bitWidth));
+    }
+    
+    switch (plan.type) {
+        case core::DataType::Int8:
+            return static_cast<int64_t>(static_cast<int8_t>(*src));
+        case core::DataType::Int16:
+            return static_cast<int64_t>(
+                static_cast<int16_t>(loadSwapped<uint16_t>(src, plan.swap)));
+        case core::DataType::Int32:
+            return static_cast<int64_t>(
+                static_cast<int32_t>(loadSwapped<uint32_t>(src, plan.swap)));
+        case core::DataType::Int64:
+            return static_cast<int64_t>(loadSwapped<uint64_t>(src, plan.swap));
+        case core::DataType::UInt8:
+            return static_cast<uint64_t>(*src);
+        case core::DataType::UInt16:
+            return static_cast<uint64_t>(loadSwapped<uint16_t>(src, plan.swap));
+        case core::DataType::UInt32:
+            return static_cast<uint64_t>(loadSwapped<uint32_t>(src, plan.swap));
+        case core::DataType::UInt64:
+            return loadSwapped<uint64_t>(src, plan.swap);
+        case core::DataType::Float32:
+            return static_cast<double>(
+                std::bit_cast<float>(loadSwapped<uint32_t>(src, plan.swap)));
+        case core::DataType::Float64:
+            return std::bit_cast<double>(loadSwapped<uint64_t>(src, plan.swap));
+        case core::DataType::Bitfield:
+            switch (plan.width) {
+                case 1: return static_cast<uint64_t>(*src);
+                case 2: return static_cast<uint64_t>(loadSwapped<uint16_t>(src, plan.swap));
+                case 4: return static_cast<uint64_t>(loadSwapped<uint32_t>(src, plan.swap));
+                default: return loadSwapped<uint64_t>(src, plan.swap);
+            }
+        case core::DataType::String:
+        case core::DataType::Bytes:
+            break;
+    }
+    return {};
+}
+
+core::Value readValue(const FieldPlan& plan, const uint8_t* frame) {
+    const uint8_t* src = frame + plan.offset;
+    
+    if (plan.count) {
+        core::Value out;
+        readArray(plan.type, src, plan.count, plan.byteOrder, out);
+        return out;
+    }
+    switch (plan.type) {
+        case core::DataType::String:
+            return std::string(reinterpret_cast<const char*>(src), plan.width);
+        case core::DataType::Bytes:
+            return std::vector<uint8_t>(src, src + plan.width);
+        default:
+            return readScalar(plan, frame).toValue();
+    }
+}
+
+core::Value borrowValue(const FieldPlan& plan, const uint8_t* frame) {
+    const uint8_t* src = frame + plan.offset;
+    switch (plan.type) {
+        case core::DataType::String:
+            return std::string_view(reinterpret_cast<const char*>(src), plan.width);
+        case core::DataType::Bytes:
+            return core::ByteView(src, plan.width);
+        default:
+            return readValue(plan, frame);
+    }
+}
+
+core::Value scaleValue(const FieldPlan& plan, const core::Value& raw) {
+    double value = 0.0;
+    if (std::holds_alternative<int64_t>(raw)) {
+        value = static_cast<double>(std::get<int64_t>(raw));
+    } else if (std::holds_alternative<uint64_t>(raw)) {
+        value = static_cast<double>(std::get<uint64_t>(raw));
+    } else if (std::holds_alternative<double>(raw)) {
+        value = std::get<double>(raw);
+    } else {
+        // Arrays scale element-wise; non-numeric types don't get scaled
+        core::Value scaled;
+        return scaleArray(raw, plan.scale, plan.bias, scaled) ? scaled : raw;
+    }
+    return (value * plan.scale) + plan.bias;
+}
+
+// --- CompiledPacket ---
+
+CompiledPacket::CompiledPacket(
+    const schema::Packet& packet,
+    core::ByteOrder byteOrder,
+    const schema::PacketNames* names
+)
+    : packet_(&packet)
+    , names_(names)
+{
+    bool swap = core::endian::needsSwap(byteOrder);
+    fields_.reserve(packet.fields.size());
+    
+    // Packed fields follow each other bit by bit; other fields start on
+    // the next byte boundary
+    std::size_t bitPos = 0;
+
+    for (std::size_t i = 0; i < packet.fields.size(); ++i) {
+        const auto& field = packet.fields[i];
+
+        FieldPlan plan;
+        plan.def = &field;
+        plan.index = i;
+        plan.type = field.type;
+        plan.byteOrder = byteOrder;
+
+        if (field.isBitPacked()) {
+            plan.bitOffset = field.bitOffset.value_or(bitPos);
+            plan.bitWidth = *field.bitCount;
+            plan.offset = plan.bitOffset / 8;
+            plan.width = (plan.bitOffset % 8 + plan.bitWidth + 7) / 8;
+            bitPos = plan.bitOffset + plan.bitWidth;
+        } else if (field.lengthField) {
+            // Read field by field once the length is known
+            plan.offset = (bitPos + 7) / 8;
+            plan.lengthIndex = static_cast<std::size_t>(packet.fieldIndex(*field.lengthField));
+            bitPos = plan.offset * 8;
+        } else {
+            plan.offset = (bitPos + 7) / 8;
+            plan.width = readWidth(field);
+            plan.count = field.isArray() ? *field.arraySize : 0;
+            plan.swap = swap && plan.width > 1;
+            bitPos = (plan.offset + plan.width) * 8;
+        }
+
+        if (field.scaling) {
+            plan.scaled = true;
+            plan.scale = field.scaling->scale;
+            plan.bias = field.scaling->offset;
+            plan.fixed = field.fixedScaling;
+            if (plan.fixed) {
+                std::tie(plan.fixedMin, plan.fixedMax) = plan.fixed->rawRange();
+            }
+        }
+
+        if (plan.width == 0) {
+            fixedSize_ = false;
+        }
+        size_ = std::max(size_, plan.offset + plan.width);
+        fields_.push_back(plan);
+    }
+}
+
+// --- Projection ---
+
+Projection::Projection(const CompiledPacket& packet, std::vector<std::size_t> fieldIndices)
+    : packet_(&packet)
+{
+    std::sort(fieldIndices.begin(), fieldIndices.end());
+    fieldIndices.erase(
+        std::unique(fieldIndices.begin(), fieldIndices.end()), fieldIndices.end());
+    
+    fields_.reserve(fieldIndices.size());
+    for (std::size_t index : fieldIndices) {
+        if (index < packet.fields().size()) {
+            fields_.push_back(&packet.fields()[index]);
+        }
+    }
+}
+
+// --- CompiledSchema ---
+
+CompiledSchema::CompiledSchema(const schema::Schema& schema)
+    : schema_(schema)
+{
+    std::vector<uint32_t> ids;
+    ids.reserve(schema.packetCount());
+    packets_.reserve(schema.packetCount());
+    for (const auto& packet : schema.packets()) {
+        ids.push_back(packet.id);
+        packets_.emplace_back(packet, schema.byteOrder(), schema.packetNames(packet.id));
+    }
+    dispatch_ = PacketDispatch(ids);
+}
+
+} // namespace ionet::codec
@@ -0,0 +1,62 @@
+#include "../../include/ionet/codec/DecodeError.h"
+#include <numeric>
+#include <sstream>
+
+namespace ionet::codec {
+
+std::string_view DecodeError::fieldName() const {
+    if (!packet || fieldIndex >= packet->fields.size()) {
+        return {};
+    }
+    return packet->fields[fieldIndex].name;
+}
+
+std::string DecodeError::message() const {
+    std::ostringstream oss;
+    std::string packetName = packet ? packet->name : std::to_string(packetId);
+    
+    switch (code) {
+        case DecodeStatus::Ok:
+            return {};
+        case DecodeStatus::UnknownPacket:
+            oss << "Unknown packet ID: " << packetId;
+            break;
+        case DecodeStatus::BelowMinimum:
+            oss << "Field '" << fieldName() << "' value " << value
+                << " is below minimum " << limit;
+            break;
+        case DecodeStatus::AboveMaximum:
+            oss << "Field '" << fieldName() << "' value " << value
+                << " is above maximum " << limit;
+            break;
+        case DecodeStatus::InvalidLength:
+            if (fieldIndex != kNoField) {
+                oss << "Field '" << fieldName() << "' at offset " << byteOffset
+                    << " has invalid length " << needed << " bytes";
+                break;
+            }
+            oss << "Packet '" << packetName << "' frame declares invalid payload length "
+                << needed;
+            break;
+        default:
+            if (fieldIndex == kNoField) {
+                oss << "Packet '" << packetName << "' needs " << needed
+                    << " bytes, have " << available;
+                break;
+            }
+            oss << "Failed to decode field '" << fieldName() << "' at offset "
+                << byteOffset << ": " << decodeStatusToString(code);
+            if (code == DecodeStatus::Truncated) {
+                oss << " (need " << needed << " bytes, have " << available << ")";
+            }
+            break;
+    }
+    return oss.str();
+}
+
+uint64_t DecodeErrorCounts::total() const {
+    // Slot 0 is DecodeStatus::Ok
+    return std::accumulate(counts_.begin() + 1, counts_.end(), uint64_t{0});
+}
+
+} // namespace ionet::codec
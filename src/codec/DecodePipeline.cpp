@@ -0,0 +1,144 @@
+#include "../../include/ionet/codec/DecodePipeline.h"
+#include <algorithm>
+
+namespace ionet::codec {
+
+DecodePipeline::DecodePipeline(
+    const Decoder& decoder,
+    PacketCallback onPacket,
+    PipelineOptions options
+)
+    : decoder_(decoder)
+    , onPacket_(std::move(onPacket))
+{
+    std::size_t count = options.workers;
+    if (count == 0) {
+        count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    
+    slab_ = std::make_unique<core::FrameSlab>(count, options.laneBytes);
+    workers_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        workers_.push_back(std::make_unique<Worker>(static_cast<uint32_t>(i), options.queueCapacity));
+    }
+    for (auto& worker : workers_) {
+        worker->thread = std::thread(&DecodePipeline::run, this, std::ref(*worker));
+    }
+}
+
+DecodePipeline::~DecodePipeline() {
+    stop();
+}
+
+bool DecodePipeline::submit(uint32_t packetId, std::span<const uint8_t> frame) {
+    if (frame.size() > slab_->laneCapacity()) {
+        return false;   // Would never fit
+    }
+    auto& worker = workerFor(packetId);
+    while (!stopping_.load(std::memory_order_relaxed)) {
+        if (push(worker, packetId, frame)) {
+            return true;
+        }
+        // Backpressure: the worker is behind, let it catch up
+        std::this_thread::yield();
+    }
+    return false;
+}
+
+bool DecodePipeline::trySubmit(uint32_t packetId, std::span<const uint8_t> frame) {
+    if (stopping_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    return push(workerFor(packetId), packetId, frame);
+}
+
+bool DecodePipeline::push(Worker& worker, uint32_t packetId, std::span<const uint8_t> frame) {
+    // Check the queue first so a frame never sits in the lane unqueued
+    if (worker.queue.full()) {
+        return false;
+    }
+    auto descriptor = slab_->write(worker.lane, frame, packetId);
+    if (!descriptor) {
+        return false;
+    }
+    worker.queue.tryPush(*descriptor);
+    
+    worker.submitted.fetch_add(1, std::memory_order_relaxed);
+    worker.signal.fetch_add(1, std::memory_order_release);
+    worker.signal.notify_one();
+    return true;
+}
+
+void DecodePipeline::flush() {
+    for (auto& worker : workers_) {
+        while (worker->processed.load(std::memory_order_acquire) <
+               worker->submitted.load(std::memory_order_relaxed)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void DecodePipeline::stop() {
+    stopping_.store(true, std::memory_order_release);
+    for (auto& worker : workers_) {
+        worker->signal.fetch_add(1, std::memory_order_release);
+        worker->signal.notify_one();
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+PipelineStats DecodePipeline::stats() const {
+    PipelineStats stats;
+    for (const auto& worker : workers_) {
+        // The worker bumps `failed` before `processed`: reading `processed`
+        // first sees at least the failures it counts, but a frame failing
+        // in between can still push `failed` one past it
+        uint64_t processed = worker->processed.load(std::memory_order_acquire);
+        uint64_t failed = worker->failed.load(std::memory_order_relaxed);
+        stats.submitted += worker->submitted.load(std::memory_order_relaxed);
+        stats.failed += failed;
+        stats.decoded += processed > failed ? processed - failed : 0;
+    }
+    return stats;
+}
+
+void DecodePipeline::run(Worker& worker) {
+    while (true) {
+        // Read the signal before checking the queue so a push in between
+        // changes it and the wait below returns at once
+        uint64_t signal = worker.signal.load(std::memory_order_acquire);
+        const core::FrameDescriptor* job = worker.queue.front();
+        
+        if (!job) {
+            if (stopping_.load(std::memory_order_acquire)) {
+                return;
+            }
+            worker.signal.wait(signal, std::memory_order_acquire);
+            continue;
+        }
+        
+        DecodeError error;
+        auto status = decoder_.decodeInto(job->tag, slab_->read(*job), worker.packet, &error);
+        if (status == DecodeStatus::Ok) {
+            if (onPacket_) {
+                onPacket_(worker.packet);
+            }
+        } else {
+            worker.failed.fetch_add(1, std::memory_order_relaxed);
+            if (onError_) {
+                onError_(error);
+            }
+        }
+        
+        // Borrowed payloads pointed into the slab until the callback returned
+        slab_->release(*job);
+        worker.queue.pop();
+        worker.processed.fetch_add(1, std::memory_order_release);
+    }
+}
+
+} // namespace ionet::codec
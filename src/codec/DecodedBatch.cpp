@@ -0,0 +1,73 @@
+#include "../../include/ionet/codec/DecodedBatch.h"
+#include <algorithm>
+
+namespace ionet::codec {
+
+// --- Column ---
+
+std::optional<double> Column::number(std::size_t row, std::size_t element) const {
+    std::size_t at = row * count + element;
+    if (isScaled) {
+        return scaled[at];
+    }
+    if (!ints.empty()) {
+        return static_cast<double>(ints[at]);
+    }
+    if (!uints.empty()) {
+        return static_cast<double>(uints[at]);
+    }
+    if (!reals.empty()) {
+        return reals[at];
+    }
+    return std::nullopt;
+}
+
+std::optional<schema::FixedPoint> Column::fixedAt(std::size_t row, std::size_t element) const {
+    if (!isFixed) {
+        return std::nullopt;
+    }
+    return schema::FixedPoint{fixed[row * count + element], fixedExponent};
+}
+
+std::string_view Column::text(std::size_t row) const {
+    if (width == 0) {
+        return {};
+    }
+    return std::string_view(
+        reinterpret_cast<const char*>(bytes.data() + row * width), width);
+}
+
+// --- DecodedBatch ---
+
+DecodedBatch::DecodedBatch(uint32_t packetId, std::string packetName, std::size_t rows)
+    : packetId_(packetId)
+    , packetName_(std::move(packetName))
+    , valid_(rows, 1)
+{}
+
+void DecodedBatch::addColumn(Column column) {
+    columns_.push_back(std::move(column));
+}
+
+const Column* DecodedBatch::column(const std::string& name) const {
+    for (const auto& col : columns_) {
+        if (col.def->name == name) {
+            return &col;
+        }
+    }
+    return nullptr;
+}
+
+const Column* DecodedBatch::column(schema::FieldHandle handle) const {
+    // Columns are stored in field order
+    if (handle.packetId != packetId_ || handle.index >= columns_.size()) {
+        return nullptr;
+    }
+    return &columns_[handle.index];
+}
+
+std::size_t DecodedBatch::invalidCount() const {
+    return static_cast<std::size_t>(std::count(valid_.begin(), valid_.end(), 0));
+}
+
+} // namespace ionet::codec
@@ -1,53 +1,417 @@
 #include "../../include/ionet/codec/DecodedPacket.h"
+#include "../../include/ionet/codec/CompiledSchema.h"
+#include "../../include/ionet/core/Kernels.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <utility>
 
 namespace ionet::codec {
 
 // --- DecodedBitfield ---
 
-bool DecodedBitfield::isSet(const std::string& flagName) const {
-    auto it = flags.find(flagName);
-    if (it != flags.end()) {
-        return it->second;
+bool DecodedBitfield::isSet(std::string_view flagName) const {
+    if (!def) {
+        return false;
     }
-    return false;
+    auto mask = def->flagMask(flagName);
+    return mask && any(*mask);
+}
+
+std::optional<uint64_t> DecodedBitfield::subfield(std::string_view subfieldName) const {
+    int index = def ? def->subfieldIndex(subfieldName) : -1;
+    if (index < 0) {
+        return std::nullopt;
+    }
+    const auto& sub = def->subfields[index];
+    return (rawValue & sub.mask()) >> sub.bit;
+}
+
+std::optional<double> DecodedBitfield::scaledSubfield(std::string_view subfieldName) const {
+    auto raw = subfield(subfieldName);
+    if (!raw) {
+        return std::nullopt;
+    }
+    const auto& scaling = def->subfields[def->subfieldIndex(subfieldName)].scaling;
+    return scaling ? scaling->apply(static_cast<int64_t>(*raw)) : static_cast<double>(*raw);
+}
+
+const std::string* DecodedBitfield::subfieldLabel(std::string_view subfieldName) const {
+    auto raw = subfield(subfieldName);
+    return raw ? def->subfields[def->subfieldIndex(subfieldName)].label(*raw) : nullptr;
+}
+
+std::size_t DecodedBitfield::extractSubfields(std::span<uint64_t> out) const {
+    if (!def) {
+        return 0;
+    }
+    
+    // Masks are written in place and replaced by the extracted values
+    const std::size_t count = std::min(out.size(), def->subfields.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = def->subfields[i].mask();
+    }
+    core::kernels::extractBits(rawValue, out.data(), count, out.data());
+    return count;
 }
 
 bool DecodedBitfield::bitAt(uint8_t bit) const {
     return (rawValue >> bit) & 1;
 }
 
+// --- Payload ---
+
+namespace detail {
+
+namespace {
+
+core::ElementArray elementsWith(const core::ElementArray& source, std::pmr::memory_resource* resource) {
+    return std::visit([&](const auto& array) {
+        using Array = std::decay_t<decltype(array)>;
+        return core::ElementArray(std::in_place_type<Array>, array, resource);
+    }, source);
+}
+
+core::ElementArray elementsWith(core::ElementArray&& source, std::pmr::memory_resource* resource) {
+    return std::visit([&](auto& array) {
+        using Array = std::decay_t<decltype(array)>;
+        return core::ElementArray(std::in_place_type<Array>, std::move(array), resource);
+    }, source);
+}
+
+/// Assign elements without letting `from` replace the resource of `to`,
+/// which variant assignment would do when the element type changes
+template<typename Source>
+void assignElements(core::ElementArray& to, Source&& from) {
+    if (to.index() == from.index()) {
+        std::visit([&](auto& array) {
+            using Array = std::decay_t<decltype(array)>;
+            array = std::get<Array>(std::forward<Source>(from));
+        }, to);
+        return;
+    }
+    auto* resource = std::visit([](const auto& array) { return array.get_allocator().resource(); }, to);
+    to = elementsWith(std::forward<Source>(from), resource);
+}
+
+} // anonymous namespace
+
+Payload::Payload(const allocator_type& alloc)
+    : contents(alloc)
+    , elements(std::in_place_index<0>, alloc)
+    , scaled(alloc)
+{}
+
+Payload::Payload(const Payload& other, const allocator_type& alloc)
+    : contents(other.contents, alloc)
+    , frame(other.frame)
+    , borrowed(other.borrowed)
+    , elements(elementsWith(other.elements, alloc.resource()))
+    , scaled(other.scaled, alloc)
+{}
+
+Payload::Payload(Payload&& other, const allocator_type& alloc)
+    : contents(std::move(other.contents), alloc)
+    , frame(other.frame)
+    , borrowed(other.borrowed)
+    , elements(elementsWith(std::move(other.elements), alloc.resource()))
+    , scaled(std::move(other.scaled), alloc)
+{}
+
+Payload& Payload::operator=(const Payload& other) {
+    if (this != &other) {
+        contents = other.contents;
+        frame = other.frame;
+        borrowed = other.borrowed;
+        assignElements(elements, other.elements);
+        scaled = other.scaled;
+    }
+    return *this;
+}
+
+Payload& Payload::operator=(Payload&& other) {
+    if (this != &other) {
+        contents = std::move(other.contents);
+        frame = other.frame;
+        borrowed = other.borrowed;
+        assignElements(elements, std::move(other.elements));
+        scaled = std::move(other.scaled);
+    }
+    return *this;
+}
+
+void Payload::copy(std::span<const uint8_t> bytes) {
+    contents.assign(bytes.begin(), bytes.end());
+    frame = {};
+    borrowed = false;
+}
+
+void Payload::borrow(std::span<const uint8_t> bytes) {
+    frame = bytes;
+    borrowed = true;
+}
+
+} // namespace detail
+
 // --- DecodedField ---
 
-core::Value DecodedField::value() const {
-    if (hasScaling()) {
-        return scaledValue;
+std::string_view DecodedField::name() const {
+    return def ? std::string_view(def->name) : std::string_view();
+}
+
+std::string_view DecodedField::unit() const {
+    return def && def->unit ? std::string_view(*def->unit) : std::string_view();
+}
+
+core::Value DecodedField::rawValue() const {
+    if (!hasPayload_) {
+        return scalar_.toValue();
+    }
+    if (core::isNumeric(type)) {
+        return widenElements(payload_->elements);
+    }
+    const auto contents = payload_->view();
+    if (type == core::DataType::String) {
+        std::string_view str(reinterpret_cast<const char*>(contents.data()), contents.size());
+        return payload_->borrowed ? core::Value(str) : core::Value(std::string(str));
+    }
+    if (payload_->borrowed) {
+        return core::ByteView(contents);
+    }
+    return std::vector<uint8_t>(contents.begin(), contents.end());
+}
+
+core::Value DecodedField::scaledValue() const {
+    if (!scaled) {
+        return rawValue();
+    }
+    if (!hasPayload_) {
+        return detail::scaled(*def->scaling, scalar_.toDouble());
+    }
+    if (core::isNumeric(type)) {
+        return core::RealArray(payload_->scaled.begin(), payload_->scaled.end());
+    }
+    return rawValue();
+}
+
+std::span<const double> DecodedField::scaledArray() const {
+    if (!scaled || !hasPayload_ || !core::isNumeric(type)) {
+        return {};
+    }
+    return payload_->scaled;
+}
+
+void DecodedField::scalePayload() {
+    if (scaled && hasPayload_ && core::isNumeric(type)) {
+        scaleElements(payload_->elements, def->scaling->scale, def->scaling->offset, payload_->scaled);
+    }
+}
+
+std::optional<schema::FixedPoint> DecodedField::fixed() const {
+    const auto value = scalar();
+    int64_t raw = 0;
+    if (value.kind() == core::Scalar::Kind::Int) {
+        raw = value.asInt();
+    } else if (value.kind() == core::Scalar::Kind::UInt && type != core::DataType::Bitfield) {
+        if (value.asUInt() > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+            return std::nullopt;
+        }
+        raw = static_cast<int64_t>(value.asUInt());
+    } else {
+        return std::nullopt;
+    }
+    if (!scaled) {
+        return schema::FixedPoint{raw, 0};
     }
-    return rawValue;
+    if (!def->fixedScaling) {
+        return std::nullopt;
+    }
+    return def->fixedScaling->apply(raw);
 }
 
-bool DecodedField::hasScaling() const {
-    // Check if scaledValue is different from rawValue
-    // This is true if scaling was applied
-    return !std::holds_alternative<std::monostate>(scaledValue) &&
-           scaledValue.index() != rawValue.index();
+std::optional<DecodedBitfield> DecodedField::bitfield() const {
+    const auto value = scalar();
+    if (type != core::DataType::Bitfield || value.kind() != core::Scalar::Kind::UInt) {
+        return std::nullopt;
+    }
+    return DecodedBitfield{value.asUInt(), def};
+}
+
+std::string_view DecodedField::text() const {
+    if (!hasPayload_ || type != core::DataType::String) {
+        return {};
+    }
+    const auto contents = payload_->view();
+    return std::string_view(reinterpret_cast<const char*>(contents.data()), contents.size());
+}
+
+std::span<const uint8_t> DecodedField::bytes() const {
+    if (!hasPayload_ || type != core::DataType::Bytes) {
+        return {};
+    }
+    return payload_->view();
 }
 
 // --- DecodedPacket ---
 
-DecodedPacket::DecodedPacket(uint32_t packetId, std::string packetName)
+DecodedPacket::DecodedPacket(const allocator_type& alloc)
+    : fields_(alloc)
+    , slots_(alloc)
+    , payloads_(alloc)
+{}
+
+DecodedPacket::DecodedPacket(uint32_t packetId, const schema::PacketNames* names, const allocator_type& alloc)
     : packetId_(packetId)
-    , packetName_(std::move(packetName)) 
+    , names_(names)
+    , fields_(alloc)
+    , slots_(alloc)
+    , payloads_(alloc)
 {}
 
+DecodedPacket::DecodedPacket(const DecodedPacket& other, const allocator_type& alloc)
+    : packetId_(other.packetId_)
+    , names_(other.names_)
+    , fields_(other.fields_, alloc)
+    , slots_(other.slots_, alloc)
+    , payloads_(other.payloads_.begin(), other.payloads_.begin() + other.usedPayloads_, alloc)
+    , usedPayloads_(other.usedPayloads_)
+{
+    rebase(other.payloads_.data(), usedPayloads_);
+}
+
+DecodedPacket::DecodedPacket(DecodedPacket&& other) noexcept
+    : packetId_(other.packetId_)
+    , names_(other.names_)
+    , fields_(std::move(other.fields_))
+    , slots_(std::move(other.slots_))
+    , payloads_(std::move(other.payloads_))
+    , usedPayloads_(std::exchange(other.usedPayloads_, 0))
+{}
+
+DecodedPacket::DecodedPacket(DecodedPacket&& other, const allocator_type& alloc)
+    : packetId_(other.packetId_)
+    , names_(other.names_)
+    , fields_(std::move(other.fields_), alloc)
+    , slots_(std::move(other.slots_), alloc)
+    , payloads_(alloc)
+{
+    // Read the old list's place before it moves (it may be taken whole)
+    const auto* from = other.payloads_.data();
+    const std::size_t count = other.payloads_.size();
+    payloads_ = std::move(other.payloads_);
+    usedPayloads_ = std::exchange(other.usedPayloads_, 0);
+    rebase(from, count);
+}
+
+DecodedPacket& DecodedPacket::operator=(const DecodedPacket& other) {
+    if (this != &other) {
+        packetId_ = other.packetId_;
+        names_ = other.names_;
+        fields_ = other.fields_;
+        slots_ = other.slots_;
+        payloads_.assign(other.payloads_.begin(), other.payloads_.begin() + other.usedPayloads_);
+        usedPayloads_ = other.usedPayloads_;
+        rebase(other.payloads_.data(), usedPayloads_);
+    }
+    return *this;
+}
+
+DecodedPacket& DecodedPacket::operator=(DecodedPacket&& other) {
+    if (this != &other) {
+        const auto* from = other.payloads_.data();
+        const std::size_t count = other.payloads_.size();
+        packetId_ = other.packetId_;
+        names_ = other.names_;
+        fields_ = std::move(other.fields_);
+        slots_ = std::move(other.slots_);
+        payloads_ = std::move(other.payloads_);
+        usedPayloads_ = std::exchange(other.usedPayloads_, 0);
+        rebase(from, count);
+    }
+    return *this;
+}
+
+void DecodedPacket::reset(uint32_t packetId, const schema::PacketNames* names) {
+    packetId_ = packetId;
+    names_ = names;
+    fields_.clear();
+    slots_.clear();
+    payloads_.clear();
+    usedPayloads_ = 0;
+}
+
+void DecodedPacket::refill(uint32_t packetId, const schema::PacketNames* names) {
+    if (packetId != packetId_ || names != names_) {
+        reset(packetId, names);
+        return;
+    }
+    fields_.clear();
+    slots_.clear();
+    usedPayloads_ = 0;
+}
+
+detail::Payload& DecodedPacket::attachPayload(DecodedField& field) {
+    if (usedPayloads_ == payloads_.size()) {
+        if (payloads_.size() == payloads_.capacity()) {
+            // Grow by hand so the old list is still there to rebase from
+            std::pmr::vector<detail::Payload> grown(payloads_.get_allocator());
+            grown.reserve(std::max<std::size_t>(4, payloads_.capacity() * 2));
+            std::move(payloads_.begin(), payloads_.end(), std::back_inserter(grown));
+            payloads_.swap(grown);
+            rebase(grown.data(), grown.size());
+        }
+        payloads_.emplace_back();
+    }
+    auto& payload = payloads_[usedPayloads_++];
+    
+    field.hasPayload_ = true;
+    field.payload_ = &payload;
+    return payload;
+}
+
+void DecodedPacket::detachPayload(DecodedField& field) {
+    // The slot stays in the list for the next field to reuse
+    if (field.hasPayload_ && usedPayloads_ > 0 && field.payload_ == &payloads_[usedPayloads_ - 1]) {
+        --usedPayloads_;
+    }
+    field.hasPayload_ = false;
+    field.scalar_ = core::Scalar();
+}
+
+void DecodedPacket::rebase(const detail::Payload* from, std::size_t count) {
+    if (from == payloads_.data()) {
+        return;
+    }
+    // Fields added by hand may point at another packet's payloads
+    std::less_equal<const detail::Payload*> atOrBefore;
+    std::less<const detail::Payload*> before;
+    for (auto& field : fields_) {
+        if (field.hasPayload_ && atOrBefore(from, field.payload_) && before(field.payload_, from + count)) {
+            field.payload_ = payloads_.data() + (field.payload_ - from);
+        }
+    }
+}
+
 void DecodedPacket::addField(DecodedField field) {
-    fieldIndex_[field.name] = fields_.size();
+    if (field.index >= slots_.size()) {
+        slots_.resize(field.index + 1, kNoSlot);
+    }
+    slots_[field.index] = static_cast<uint32_t>(fields_.size());
     fields_.push_back(std::move(field));
 }
 
-const DecodedField* DecodedPacket::field(const std::string& name) const {
-    auto it = fieldIndex_.find(name);
-    if (it != fieldIndex_.end()) {
-        return &fields_[it->second];
+const DecodedField* DecodedPacket::field(std::string_view name) const {
+    if (names_) {
+        int index = names_->find(name);
+        return index >= 0 ? field(schema::FieldHandle{packetId_, static_cast<uint32_t>(index)}) : nullptr;
+    }
+    
+    // Without the schema's names, search the fields themselves
+    for (const auto& f : fields_) {
+        if (f.name() == name) {
+            return &f;
+        }
     }
     return nullptr;
 }
@@ -59,8 +423,20 @@ const DecodedField* DecodedPacket::fieldAt(std::size_t index) const {
     return nullptr;
 }
 
-bool DecodedPacket::hasField(const std::string& name) const {
-    return fieldIndex_.find(name) != fieldIndex_.end();
+const DecodedField* DecodedPacket::field(schema::FieldHandle handle) const {
+    if (handle.packetId != packetId_ || handle.index >= slots_.size()) {
+        return nullptr;
+    }
+    uint32_t slot = slots_[handle.index];
+    return slot != kNoSlot ? &fields_[slot] : nullptr;
+}
+
+bool DecodedPacket::hasField(std::string_view name) const {
+    return field(name) != nullptr;
+}
+
+bool DecodedPacket::hasField(schema::FieldHandle handle) const {
+    return field(handle) != nullptr;
 }
 
 } // namespace ionet::codec
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "../../include/ionet/codec/DecodedPacketView.h"
+
+namespace ionet::codec {
+
+DecodedPacketView::DecodedPacketView(
+    const CompiledPacket& plan,
+    std::span<const uint8_t> frame,
+    bool applyScaling,
+    bool borrowPayloads
+)
+    : plan_(&plan)
+    , frame_(frame)
+    , applyScaling_(applyScaling)
+    , borrowPayloads_(borrowPayloads)
+{}
+
+const FieldPlan* DecodedPacketView::findPlan(std::string_view fieldName) const {
+    if (const auto* names = plan_->names()) {
+        int index = names->find(fieldName);
+        return index >= 0 ? &plan_->fields()[index] : nullptr;
+    }
+    
+    // Without the schema's names, search the plans themselves
+    for (const auto& plan : plan_->fields()) {
+        if (plan.def->name == fieldName) {
+            return &plan;
+        }
+    }
+    return nullptr;
+}
+
+core::Value DecodedPacketView::rawOf(const FieldPlan& plan) const {
+    return borrowPayloads_ ? borrowValue(plan, frame_.data()) : readValue(plan, frame_.data());
+}
+
+core::Value DecodedPacketView::valueOf(const FieldPlan& plan) const {
+    auto raw = rawOf(plan);
+    if (applyScaling_ && plan.scaled) {
+        return scaleValue(plan, raw);
+    }
+    return raw;
+}
+
+bool DecodedPacketView::hasField(std::string_view name) const {
+    return findPlan(name) != nullptr;
+}
+
+core::Value DecodedPacketView::raw(std::string_view fieldName) const {
+    const auto* plan = findPlan(fieldName);
+    if (!plan) {
+        return std::monostate{};
+    }
+    return rawOf(*plan);
+}
+
+core::Value DecodedPacketView::rawAt(std::size_t index) const {
+    if (index >= plan_->fields().size()) {
+        return std::monostate{};
+    }
+    return rawOf(plan_->fields()[index]);
+}
+
+core::Value DecodedPacketView::value(std::string_view fieldName) const {
+    const auto* plan = findPlan(fieldName);
+    if (!plan) {
+        return std::monostate{};
+    }
+    return valueOf(*plan);
+}
+
+core::Value DecodedPacketView::valueAt(std::size_t index) const {
+    if (index >= plan_->fields().size()) {
+        return std::monostate{};
+    }
+    return valueOf(plan_->fields()[index]);
+}
+
+} // namespace ionet::codec
@@ -1,19 +1,181 @@
 #include "../../include/ionet/codec/Decoder.h"
+#include "../../include/ionet/core/Kernels.h"
+#include <algorithm>
 #include <cmath>
-#include <sstream>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <optional>
 
 namespace ionet::codec {
 
+namespace {
+
+using Rows = std::vector<const uint8_t*>;
+
+/// Copy one field's bytes from every row into a packed run (zeros for missing rows)
+void gatherBytes(const FieldPlan& plan, const Rows& rows, std::vector<uint8_t>& packed) {
+    packed.assign(rows.size() * plan.width, 0);
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (rows[i]) {
+            std::memcpy(packed.data() + i * plan.width, rows[i] + plan.offset, plan.width);
+        }
+    }
+}
+
+/// Unsigned type matching a bitfield's read width
+core::DataType maskType(std::size_t width) {
+    switch (width) {
+        case 1: return core::DataType::UInt8;
+        case 2: return core::DataType::UInt16;
+        case 4: return core::DataType::UInt32;
+        default: return core::DataType::UInt64;
+    }
+}
+
+/// Extract a bit-packed field from every row (zeros for missing rows)
+void fillPackedColumn(Column& col, const FieldPlan& plan, const Rows& rows) {
+    const bool isSigned = core::isSigned(plan.type);
+    if (isSigned) {
+        col.ints.assign(rows.size(), 0);
+    } else {
+        col.uints.assign(rows.size(), 0);
+    }
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (!rows[i]) {
+            continue;
+        }
+        auto value = readScalar(plan, rows[i]);
+        if (isSigned) {
+            col.ints[i] = value.asInt();
+        } else {
+            col.uints[i] = value.asUInt();
+        }
+    }
+}
+
+/// Fill a column with one field's raw values for every row.
+/// Values are gathered into a packed run, then converted in bulk.
+void fillColumn(Column& col, const FieldPlan& plan, const Rows& rows, std::vector<uint8_t>& scratch) {
+    const std::size_t n = rows.size();
+    
+    if (plan.type == core::DataType::String || plan.type == core::DataType::Bytes) {
+        col.width = plan.width;
+        gatherBytes(plan, rows, col.bytes);
+        return;
+    }
+    
+    if (plan.bitWidth) {
+        fillPackedColumn(col, plan, rows);
+        return;
+    }
+    
+    gatherBytes(plan, rows, scratch);
+    
+    // Array rows are whole runs of elements, so they convert in the same call
+    col.count = plan.count ? plan.count : 1;
+    const std::size_t elements = n * col.count;
+    
+    if (plan.type == core::DataType::Bitfield) {
+        col.uints.resize(n);
+        core::kernels::toUInt64(maskType(plan.width), scratch.data(), n, plan.byteOrder, col.uints.data());
+    } else if (core::isSigned(plan.type)) {
+        col.ints.resize(elements);
+        core::kernels::toInt64(plan.type, scratch.data(), elements, plan.byteOrder, col.ints.data());
+    } else if (core::isUnsigned(plan.type)) {
+        col.uints.resize(elements);
+        core::kernels::toUInt64(plan.type, scratch.data(), elements, plan.byteOrder, col.uints.data());
+    } else {
+        col.reals.resize(elements);
+        core::kernels::toDouble(plan.type, scratch.data(), elements, plan.byteOrder, col.reals.data());
+    }
+}
+
+/// Strings and bytes: copied or borrowed whole, never scaled
+bool isPayload(core::DataType type) {
+    return type == core::DataType::String || type == core::DataType::Bytes;
+}
+
+/// Fields whose value lives in the packet's payload list
+bool storesPayload(const schema::Field& def) {
+    return !def.isBitPacked() && (isPayload(def.type) || def.isArray() || def.lengthField);
+}
+
+/// Copy (or borrow) a string or bytes field's contents
+void setPayload(std::span<const uint8_t> bytes, bool borrow, detail::Payload& out) {
+    if (borrow) {
+        out.borrow(bytes);
+    } else {
+        out.copy(bytes);
+    }
+}
+
+/// Attach packet/field context to an error (if one was requested)
+void locate(DecodeError* error, const schema::Packet& packet, std::size_t fieldIndex, std::size_t byteOffset) {
+    if (error) {
+        error->packetId = packet.id;
+        error->packet = &packet;
+        error->fieldIndex = static_cast<uint32_t>(fieldIndex);
+        error->byteOffset = byteOffset;
+    }
+}
+
+/// Frame too short for a fixed-size packet
+DecodeError truncatedPacket(const CompiledPacket& plan, std::size_t available) {
+    DecodeError error;
+    error.code = DecodeStatus::Truncated;
+    error.packetId = plan.id();
+    error.packet = &plan.packet();
+    error.needed = plan.size();
+    error.available = available;
+    return error;
+}
+
+} // anonymous namespace
+
+/// Older plans are kept, not freed, since projections and views
+/// point into them
+struct Decoder::Plans {
+    std::atomic<const CompiledSchema*> current{nullptr};
+    std::mutex mutex;   // Serializes rebuilds
+    std::vector<std::unique_ptr<const CompiledSchema>> compiled;
+    
+    explicit Plans(const schema::Schema& schema) {
+        compiled.push_back(std::make_unique<const CompiledSchema>(schema));
+        current.store(compiled.back().get(), std::memory_order_release);
+    }
+};
+
 Decoder::Decoder(const schema::Schema& schema)
     : schema_(schema)
+    , plans_(std::make_shared<Plans>(schema))
     , options_{}
 {}
 
 Decoder::Decoder(const schema::Schema& schema, DecodeOptions options)
     : schema_(schema)
+    , plans_(std::make_shared<Plans>(schema))
     , options_(options)
 {}
 
+const CompiledSchema& Decoder::compiled() const {
+    // Packets are only ever added, so a count that still matches means
+    // the plans are current
+    const auto* current = plans_->current.load(std::memory_order_acquire);
+    if (current->packets().size() == schema_.packetCount()) {
+        return *current;
+    }
+    
+    std::lock_guard lock(plans_->mutex);
+    current = plans_->current.load(std::memory_order_relaxed);
+    if (current->packets().size() != schema_.packetCount()) {
+        plans_->compiled.push_back(std::make_unique<const CompiledSchema>(schema_));
+        current = plans_->compiled.back().get();
+        plans_->current.store(current, std::memory_order_release);
+    }
+    return *current;
+}
+
 core::Result<DecodedPacket> Decoder::decode(
     uint32_t packetId,
     std::span<const uint8_t> data
@@ -40,257 +202,790 @@ core::Result<DecodedPacket> Decoder::decodeByName(
     return decode(packet->id, data);
 }
 
+DecodeStatus Decoder::decodeInto(
+    uint32_t packetId,
+    std::span<const uint8_t> data,
+    DecodedPacket& out,
+    DecodeError* errorOut
+) const {
+    const auto* plan = compiled().find(packetId);
+    if (!plan) {
+        if (errorOut) {
+            *errorOut = DecodeError{};
+            errorOut->code = DecodeStatus::UnknownPacket;
+            errorOut->packetId = packetId;
+        }
+        return DecodeStatus::UnknownPacket;
+    }
+    
+    // Variable layouts and short frames are read field by field
+    if (!plan->isFixedSize() || data.size() < plan->size()) {
+        if (plan->isFixedSize() && options_.stopOnError) {
+            if (errorOut) {
+                *errorOut = truncatedPacket(*plan, data.size());
+            }
+            return DecodeStatus::Truncated;
+        }
+        core::ByteBufferReader reader(data.data(), data.size());
+        out.refill(packetId, plan->names());
+        return decodeFields(*plan, reader, out, errorOut);
+    }
+    
+    const auto& steps = plan->fields();
+    core::BitReader bits(data.first(plan->size()));
+    
+    // Lay the packet out once; same-type refills keep the slots
+    if (out.id() != packetId || out.fields_.size() != steps.size()) {
+        out.refill(packetId, plan->names());
+        for (const auto& step : steps) {
+            out.addField(decodeField(step, data.data(), bits, out));
+        }
+    } else {
+        for (std::size_t i = 0; i < steps.size(); ++i) {
+            fillField(steps[i], data.data(), bits, out.fields_[i]);
+        }
+    }
+    
+    if (options_.validateConstraints) {
+        for (const auto& step : steps) {
+            auto status = validateConstraints(out.fields_[step.index], *step.def, errorOut);
+            if (status != DecodeStatus::Ok && options_.stopOnError) {
+                locate(errorOut, plan->packet(), step.index, step.offset);
+                return status;
+            }
+        }
+    }
+    
+    return DecodeStatus::Ok;
+}
+
 core::Result<DecodedPacket> Decoder::decode(
     uint32_t packetId,
     core::ByteBufferReader& reader
 ) const {
     // Find packet definition
-    const auto* packetDef = schema_.findPacketById(packetId);
-    if (!packetDef) {
+    const auto* plan = compiled().find(packetId);
+    if (!plan) {
         return core::Error{"Unknown packet ID: " + std::to_string(packetId)};
     }
     
-    DecodedPacket result(packetId, packetDef->name);
+    // Fixed-size packets: one length check, then straight reads at known offsets
+    if (plan->isFixedSize()) {
+        if (reader.has(plan->size())) {
+            auto result = decodeCompiled(*plan, reader.data() + reader.position());
+            if (result.ok()) {
+                reader.skip(plan->size());
+            }
+            return result;
+        }
+        if (options_.stopOnError) {
+            return core::Error{truncatedPacket(*plan, reader.remaining()).message()};
+        }
+        // Short frame with error collection: fall through and decode what fits
+    }
+    
+    DecodedPacket result(packetId, plan->names());
+    DecodeError error;
+    if (decodeFields(*plan, reader, result, &error) != DecodeStatus::Ok) {
+        return core::Error{error.message()};
+    }
+    return result;
+}
+
+DecodeStatus Decoder::decodeFields(
+    const CompiledPacket& plan,
+    core::ByteBufferReader& reader,
+    DecodedPacket& out,
+    DecodeError* errorOut
+) const {
+    const auto& packetDef = plan.packet();
     core::ByteOrder byteOrder = schema_.byteOrder();
     
+    // Packed fields run bit by bit from the packet start; the reader stays
+    // on the byte after the last bit read, where aligned fields resume
+    const std::size_t start = reader.position();
+    std::size_t bitPos = 0;
+    
     // Decode each field
-    for (const auto& fieldDef : packetDef->fields) {
-        auto fieldResult = decodeField(fieldDef, reader, byteOrder);
+    for (const auto& step : plan.fields()) {
+        const auto& fieldDef = *step.def;
+        std::size_t offset = reader.position();
+        std::size_t needed = fieldDef.byteSize();
         
-        if (fieldResult.hasError()) {
+        DecodedField decodedField;
+        decodedField.index = static_cast<uint32_t>(step.index);
+        if (storesPayload(fieldDef)) {
+            out.attachPayload(decodedField);
+        }
+        DecodeStatus status;
+        if (fieldDef.isBitPacked()) {
+            offset = start + fieldDef.bitOffset.value_or(bitPos) / 8;
+            status = decodePackedField(fieldDef, reader, start, bitPos, decodedField);
+        } else if (step.lengthIndex) {
+            status = decodeVariableField(step, out, reader, byteOrder, needed, decodedField);
+            bitPos = (reader.position() - start) * 8;
+        } else {
+            status = decodeField(fieldDef, reader, byteOrder, decodedField);
+            bitPos = (reader.position() - start) * 8;
+        }
+        
+        if (status != DecodeStatus::Ok) {
+            // The field is dropped, so its payload slot is not kept
+            out.detachPayload(decodedField);
             if (options_.stopOnError) {
-                return core::Error{
-                    "Failed to decode field '" + fieldDef.name + "': " +
-                    fieldResult.error().message
-                };
+                if (errorOut) {
+                    *errorOut = DecodeError{};
+                    errorOut->code = status;
+                    errorOut->needed = needed;
+                    errorOut->available = reader.remaining();
+                    locate(errorOut, packetDef, decodedField.index, offset);
+                }
+                return status;
             }
             // Continue with next field if not stopping on error
             continue;
         }
         
-        auto& decodedField = fieldResult.value();
-        
         // Validate constraints
         if (options_.validateConstraints) {
-            std::string constraintError;
-            if (!validateConstraints(decodedField, fieldDef, &constraintError)) {
-                if (options_.stopOnError) {
-                    return core::Error{constraintError};
-                }
+            status = validateConstraints(decodedField, fieldDef, errorOut);
+            if (status != DecodeStatus::Ok && options_.stopOnError) {
+                locate(errorOut, packetDef, decodedField.index, offset);
+                return status;
             }
         }
         
-        result.addField(std::move(decodedField));
+        out.addField(std::move(decodedField));
     }
     
-    return result;
+    return DecodeStatus::Ok;
 }
 
-core::Result<DecodedField> Decoder::decodeField(
-    const schema::Field& fieldDef,
-    core::ByteBufferReader& reader,
-    core::ByteOrder byteOrder
+core::Result<Projection> Decoder::project(
+    uint32_t packetId,
+    const std::vector<std::string>& fieldNames
 ) const {
-    DecodedField field;
-    field.name = fieldDef.name;
-    field.type = fieldDef.type;
-    field.unit = fieldDef.unit.value_or<std::string>("");
-    
-    try {
-        switch (fieldDef.type) {
-            case core::DataType::Int8: {
-                auto val = reader.readInt8();
-                field.rawValue = static_cast<int64_t>(val);
-                break;
-            }
-            case core::DataType::Int16: {
-                auto val = reader.readInt16(byteOrder);
-                field.rawValue = static_cast<int64_t>(val);
-                break;
-            }
-            case core::DataType::Int32: {
-                auto val = reader.readInt32(byteOrder);
-                field.rawValue = static_cast<int64_t>(val);
-                break;
-            }
-            case core::DataType::Int64: {
-                auto val = reader.readInt64(byteOrder);
-                field.rawValue = static_cast<int64_t>(val);
-                break;
-            }
-            case core::DataType::UInt8: {
-                auto val = reader.readUInt8();
-                field.rawValue = static_cast<uint64_t>(val);
-                break;
-            }
-            case core::DataType::UInt16: {
-                auto val = reader.readUInt16(byteOrder);
-                field.rawValue = static_cast<uint64_t>(val);
-                break;
+    std::string error;
+    const auto* plan = findFixedPlan(packetId, &error);
+    if (!plan) {
+        return core::Error{error};
+    }
+    
+    std::vector<std::size_t> indices;
+    indices.reserve(fieldNames.size());
+    for (const auto& name : fieldNames) {
+        int index = plan->packet().fieldIndex(name);
+        if (index < 0) {
+            return core::Error{
+                "Unknown field '" + name + "' in packet '" + plan->packet().name + "'"
+            };
+        }
+        indices.push_back(static_cast<std::size_t>(index));
+    }
+    
+    return Projection(*plan, std::move(indices));
+}
+
+core::Result<Projection> Decoder::project(
+    const std::vector<schema::FieldHandle>& fields
+) const {
+    if (fields.empty()) {
+        return core::Error{"Projection needs at least one field"};
+    }
+    
+    uint32_t packetId = fields.front().packetId;
+    std::string error;
+    const auto* plan = findFixedPlan(packetId, &error);
+    if (!plan) {
+        return core::Error{error};
+    }
+    
+    std::vector<std::size_t> indices;
+    indices.reserve(fields.size());
+    for (const auto& handle : fields) {
+        if (handle.packetId != packetId || handle.index >= plan->fields().size()) {
+            return core::Error{"Field handle does not belong to packet '" + plan->packet().name + "'"};
+        }
+        indices.push_back(handle.index);
+    }
+    
+    return Projection(*plan, std::move(indices));
+}
+
+core::Result<DecodedPacket> Decoder::decode(
+    const Projection& projection,
+    std::span<const uint8_t> data
+) const {
+    const auto* plan = projection.packet();
+    if (!plan) {
+        return core::Error{"Empty projection"};
+    }
+    if (data.size() < plan->size()) {
+        return core::Error{
+            "Packet '" + plan->packet().name + "' needs " +
+            std::to_string(plan->size()) + " bytes, have " +
+            std::to_string(data.size())
+        };
+    }
+    return decodeCompiled(*plan, data.data(), &projection);
+}
+
+core::Result<DecodedPacketView> Decoder::view(
+    uint32_t packetId,
+    std::span<const uint8_t> data
+) const {
+    const auto* plan = compiled().find(packetId);
+    if (!plan) {
+        return core::Error{"Unknown packet ID: " + std::to_string(packetId)};
+    }
+    if (!plan->isFixedSize()) {
+        return core::Error{"Packet '" + plan->packet().name + "' has no fixed layout"};
+    }
+    if (data.size() < plan->size()) {
+        return core::Error{
+            "Packet '" + plan->packet().name + "' needs " +
+            std::to_string(plan->size()) + " bytes, have " +
+            std::to_string(data.size())
+        };
+    }
+    return DecodedPacketView(
+        *plan, data.first(plan->size()), options_.applyScaling, options_.borrowPayloads);
+}
+
+core::Result<DecodedBatch> Decoder::decodeBatch(
+    uint32_t packetId,
+    std::span<const std::span<const uint8_t>> frames
+) const {
+    std::string error;
+    const auto* plan = findFixedPlan(packetId, &error);
+    if (!plan) {
+        return core::Error{error};
+    }
+    
+    std::vector<const uint8_t*> rows(frames.size(), nullptr);
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        if (frames[i].size() >= plan->size()) {
+            rows[i] = frames[i].data();
+        } else if (options_.stopOnError) {
+            return core::Error{
+                "Frame " + std::to_string(i) + ": packet '" + plan->packet().name +
+                "' needs " + std::to_string(plan->size()) + " bytes, have " +
+                std::to_string(frames[i].size())
+            };
+        }
+    }
+    
+    return decodeRows(*plan, rows);
+}
+
+core::Result<DecodedBatch> Decoder::decodeBatch(
+    uint32_t packetId,
+    std::span<const uint8_t> data,
+    std::size_t stride
+) const {
+    std::string error;
+    const auto* plan = findFixedPlan(packetId, &error);
+    if (!plan) {
+        return core::Error{error};
+    }
+    if (stride < plan->size()) {
+        return core::Error{
+            "Stride " + std::to_string(stride) + " is smaller than packet '" +
+            plan->packet().name + "' (" + std::to_string(plan->size()) + " bytes)"
+        };
+    }
+    
+    // A trailing partial frame is ignored
+    std::vector<const uint8_t*> rows(data.size() / stride);
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        rows[i] = data.data() + i * stride;
+    }
+    
+    return decodeRows(*plan, rows);
+}
+
+const CompiledPacket* Decoder::findFixedPlan(
+    uint32_t packetId,
+    std::string* errorMsg
+) const {
+    const auto* plan = compiled().find(packetId);
+    if (!plan) {
+        *errorMsg = "Unknown packet ID: " + std::to_string(packetId);
+        return nullptr;
+    }
+    if (!plan->isFixedSize()) {
+        *errorMsg = "Packet '" + plan->packet().name + "' has no fixed layout";
+        return nullptr;
+    }
+    return plan;
+}
+
+core::Result<DecodedBatch> Decoder::decodeRows(
+    const CompiledPacket& plan,
+    const std::vector<const uint8_t*>& rows
+) const {
+    DecodedBatch batch(plan.id(), plan.packet().name, rows.size());
+    std::vector<std::size_t> shortRows;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (!rows[i]) {
+            batch.invalidate(i);
+            shortRows.push_back(i);
+        }
+    }
+    
+    std::vector<uint8_t> scratch;
+    for (const auto& step : plan.fields()) {
+        Column col;
+        col.def = step.def;
+        col.type = step.type;
+        fillColumn(col, step, rows, scratch);
+        
+        const std::size_t elements = rows.size() * col.count;
+        if (options_.applyScaling && step.scaled && !col.width) {
+            col.isScaled = true;
+            col.scaled.resize(elements);
+            if (!step.bitWidth && step.type != core::DataType::Bitfield) {
+                // Still packed in scratch: 16/32-bit values skip the int64 step
+                core::kernels::toScaled(step.type, scratch.data(), elements, step.byteOrder,
+                                        step.scale, step.bias, col.scaled.data());
+            } else if (!col.ints.empty()) {
+                core::kernels::scale(col.ints.data(), elements, step.scale, step.bias, col.scaled.data());
+            } else if (!col.uints.empty()) {
+                core::kernels::scale(col.uints.data(), elements, step.scale, step.bias, col.scaled.data());
+            } else if (!col.reals.empty()) {
+                core::kernels::scale(col.reals.data(), elements, step.scale, step.bias, col.scaled.data());
             }
-            case core::DataType::UInt32: {
-                auto val = reader.readUInt32(byteOrder);
-                field.rawValue = static_cast<uint64_t>(val);
-                break;
+        }
+        if (options_.fixedPointScaling && step.fixed && !col.width) {
+            const auto& fixed = *step.fixed;
+            col.isFixed = true;
+            col.fixedExponent = fixed.exponent;
+            col.fixed.resize(elements);
+            if (!col.ints.empty()) {
+                core::kernels::scaleFixed(col.ints.data(), elements, fixed.multiplier, fixed.bias, col.fixed.data());
+            } else if (!col.uints.empty()) {
+                core::kernels::scaleFixed(col.uints.data(), elements, fixed.multiplier, fixed.bias, col.fixed.data());
             }
-            case core::DataType::UInt64: {
-                auto val = reader.readUInt64(byteOrder);
-                field.rawValue = static_cast<uint64_t>(val);
-                break;
+            
+            // The kernel wraps; values whose fixed form overflows int64
+            // invalidate their row, as DecodedField::fixed() has none for them
+            for (std::size_t k = 0; k < elements; ++k) {
+                const bool fits = !col.ints.empty()
+                    ? col.ints[k] >= step.fixedMin && col.ints[k] <= step.fixedMax
+                    : col.uints[k] <= static_cast<uint64_t>(step.fixedMax);
+                if (fits) {
+                    continue;
+                }
+                col.fixed[k] = 0;
+                std::size_t i = k / col.count;
+                if (!batch.isValid(i)) {
+                    continue;
+                }
+                if (options_.stopOnError) {
+                    return core::Error{
+                        "Frame " + std::to_string(i) + ": field '" + step.def->name + "' value " +
+                        (!col.ints.empty() ? std::to_string(col.ints[k]) : std::to_string(col.uints[k])) +
+                        " does not fit in fixed point"
+                    };
+                }
+                batch.invalidate(i);
             }
-            case core::DataType::Float32: {
-                auto val = reader.readFloat32(byteOrder);
-                field.rawValue = static_cast<double>(val);
-                break;
+        }
+        
+        // Short frames were read as zeros; scaling gave them the offset
+        for (std::size_t i : shortRows) {
+            if (col.isScaled) {
+                std::fill_n(col.scaled.begin() + (i * col.count), col.count, 0.0);
             }
-            case core::DataType::Float64: {
-                auto val = reader.readFloat64(byteOrder);
-                field.rawValue = val;
-                break;
+            if (col.isFixed) {
+                std::fill_n(col.fixed.begin() + (i * col.count), col.count, 0);
             }
-            case core::DataType::Bitfield: {
-                uint64_t rawVal = 0;
-                uint8_t bitCount = fieldDef.bitCount.value_or(8);
-                
-                if (bitCount <= 8) {
-                    rawVal = reader.readUInt8();
-                } else if (bitCount <= 16) {
-                    rawVal = reader.readUInt16(byteOrder);
-                } else if (bitCount <= 32) {
-                    rawVal = reader.readUInt32(byteOrder);
-                } else {
-                    rawVal = reader.readUInt64(byteOrder);
+        }
+        
+        // Constraint limits are in engineering units
+        const auto& limits = step.def->constraints;
+        if (options_.validateConstraints && (limits.min || limits.max) && !col.width) {
+            for (std::size_t k = 0; k < elements; ++k) {
+                std::size_t i = k / col.count;
+                if (!batch.isValid(i)) {
+                    continue;
                 }
-                
-                field.rawValue = rawVal;
-                field.bitfield = decodeBitfield(rawVal, fieldDef);
-                break;
-            }
-            case core::DataType::String: {
-                std::size_t size = fieldDef.stringSize.value_or(0);
-                if (size == 0) {
-                    return core::Error{"String field requires size"};
+                double value = *col.number(i, k % col.count);
+                if (step.scaled && !col.isScaled && !options_.rawConstraints) {
+                    value = (value * step.scale) + step.bias;
                 }
-                auto str = reader.readString(size);
-                field.rawValue = str;
-                break;
-            }
-            case core::DataType::Bytes: {
-                std::size_t size = fieldDef.arraySize.value_or(0);
-                if (size == 0) {
-                    return core::Error{"Bytes field requires size"};
+                bool below = limits.min && value < *limits.min;
+                bool above = limits.max && value > *limits.max;
+                if (!below && !above) {
+                    continue;
                 }
-                auto bytes = reader.readBytes(size);
-                field.rawValue = bytes;
-                break;
+                if (options_.stopOnError) {
+                    DecodeError error;
+                    error.code = below ? DecodeStatus::BelowMinimum : DecodeStatus::AboveMaximum;
+                    error.value = value;
+                    error.limit = below ? *limits.min : *limits.max;
+                    locate(&error, plan.packet(), step.index, step.offset);
+                    return core::Error{"Frame " + std::to_string(i) + ": " + error.message()};
+                }
+                batch.invalidate(i);
             }
-            default:
-                return core::Error{"Unsupported data type"};
         }
-    } catch (const std::exception& e) {
-        return core::Error{std::string("Read error: ") + e.what()};
+        
+        batch.addColumn(std::move(col));
     }
     
-    // Apply scaling if enabled and defined
-    if (options_.applyScaling && fieldDef.scaling.has_value()) {
-        field.scaledValue = applyScaling(field.rawValue, *fieldDef.scaling);
+    return batch;
+}
+
+core::Result<DecodedPacket> Decoder::decodeCompiled(
+    const CompiledPacket& plan,
+    const uint8_t* frame,
+    const Projection* projection
+) const {
+    DecodedPacket result(plan.id(), plan.names());
+    core::BitReader bits(std::span<const uint8_t>(frame, plan.size()));
+    
+    auto decodeStep = [&](const FieldPlan& step) -> std::optional<core::Error> {
+        auto decodedField = decodeField(step, frame, bits, result);
+        
+        if (options_.validateConstraints) {
+            DecodeError error;
+            auto status = validateConstraints(decodedField, *step.def, &error);
+            if (status != DecodeStatus::Ok && options_.stopOnError) {
+                locate(&error, plan.packet(), step.index, step.offset);
+                return core::Error{error.message()};
+            }
+        }
+        
+        result.addField(std::move(decodedField));
+        return std::nullopt;
+    };
+    
+    if (projection) {
+        for (const auto* step : projection->fields()) {
+            if (auto error = decodeStep(*step)) {
+                return *error;
+            }
+        }
     } else {
-        field.scaledValue = field.rawValue;
+        for (const auto& step : plan.fields()) {
+            if (auto error = decodeStep(step)) {
+                return *error;
+            }
+        }
     }
     
+    return result;
+}
+
+DecodedField Decoder::decodeField(
+    const FieldPlan& plan,
+    const uint8_t* frame,
+    core::BitReader& bits,
+    DecodedPacket& out
+) const {
+    DecodedField field;
+    field.index = static_cast<uint32_t>(plan.index);
+    field.type = plan.type;
+    if (storesPayload(*plan.def)) {
+        out.attachPayload(field);
+    }
+    fillField(plan, frame, bits, field);
     return field;
 }
 
-DecodedBitfield Decoder::decodeBitfield(
-    uint64_t rawValue,
-    const schema::Field& fieldDef
+void Decoder::fillField(
+    const FieldPlan& plan,
+    const uint8_t* frame,
+    core::BitReader& bits,
+    DecodedField& field
 ) const {
-    DecodedBitfield bf;
-    bf.rawValue = rawValue;
+    field.def = plan.def;
+    field.scaled = options_.applyScaling && plan.scaled && !isPayload(plan.type);
     
-    for (const auto& flag : fieldDef.bitFlags) {
-        bool isSet = (rawValue >> flag.bit) & 1;
-        bf.flags[flag.name] = isSet;
+    // Scalars never touch the payload and are scaled when read; arrays
+    // are scaled here, into the payload's own elements
+    if (plan.bitWidth) {
+        field.setScalar(readPacked(plan, bits));
+    } else if (plan.count) {
+        readElements(plan.type, frame + plan.offset, plan.count, plan.byteOrder, field.payload_->elements);
+        field.scalePayload();
+    } else if (isPayload(plan.type)) {
+        setPayload({frame + plan.offset, plan.width}, options_.borrowPayloads, *field.payload_);
+    } else {
+        field.setScalar(readScalar(plan, frame));
+    }
+}
+
+DecodeStatus Decoder::decodeField(
+    const schema::Field& fieldDef,
+    core::ByteBufferReader& reader,
+    core::ByteOrder byteOrder,
+    DecodedField& field
+) const {
+    describeField(fieldDef, field);
+    
+    // Every read leaves the reader untouched when the frame is too short
+    
+    // Numeric arrays are viewed in place and converted in bulk
+    if (fieldDef.isArray()) {
+        std::span<const uint8_t> elements;
+        if (!reader.tryReadBytes(fieldDef.byteSize(), elements)) return DecodeStatus::Truncated;
+        readElements(fieldDef.type, elements.data(), *fieldDef.arraySize, byteOrder, field.payload_->elements);
+        field.scalePayload();
+        return DecodeStatus::Ok;
     }
     
-    return bf;
+    switch (fieldDef.type) {
+        case core::DataType::Int8: {
+            int8_t val;
+            if (!reader.tryReadInt8(val)) return DecodeStatus::Truncated;
+            field.setScalar(static_cast<int64_t>(val));
+            break;
+        }
+        case core::DataType::Int16: {
+            int16_t val;
+            if (!reader.tryReadInt16(val, byteOrder)) return DecodeStatus::Truncated;
+            field.setScalar(static_cast<int64_t>(val));
+            break;
+        }
+        case core::DataType::Int32: {
+            int32_t val;
+            if (!reader.tryReadInt32(val, byteOrder)) return DecodeStatus::Truncated;
+            field.setScalar(static_cast<int64_t>(val));
+            break;
+        }
+        case core::DataType::Int64: {
+            int64_t val;
+            if (!reader.tryReadInt64(val, byteOrder)) return DecodeStatus::Truncated;
+            field.setScalar(val);
+            break;
+        }
+        case core::DataType::UInt8: {
+            uint8_t val;
+            if (!reader.tryReadUInt8(val)) return DecodeStatus::Truncated;
+            field.setScalar(static_cast<uint64_t>(val));
+            break;
+        }
+        case core::DataType::UInt16: {
+            uint16_t val;
+            if (!reader.tryReadUInt16(val, byteOrder)) return DecodeStatus::Truncated;
+            field.setScalar(static_cast<uint64_t>(val));
+            break;
+        }
+        case core::DataType::UInt32: {
+            uint32_t val;
+            if (!reader.tryReadUInt32(val, byteOrder)) return DecodeStatus::Truncated;
+            field.setScalar(static_cast<uint64_t>(val));
+            break;
+        }
+        case core::DataType::UInt64: {
+            uint64_t val;
+            if (!reader.tryReadUInt64(val, byteOrder)) return DecodeStatus::Truncated;
+            field.setScalar(val);
+            break;
+        }
+        case core::DataType::Float32: {
+            float val;
+            if (!reader.tryReadFloat32(val, byteOrder)) return DecodeStatus::Truncated;
+            field.setScalar(static_cast<double>(val));
+            break;
+        }
+        case core::DataType::Float64: {
+            double val;
+            if (!reader.tryReadFloat64(val, byteOrder)) return DecodeStatus::Truncated;
+            field.setScalar(val);
+            break;
+        }
+        case core::DataType::Bitfield: {
+            uint64_t rawVal = 0;
+            uint8_t bitCount = fieldDef.bitCount.value_or(8);
+            bool ok;
+            
+            if (bitCount <= 8) {
+                uint8_t val = 0;
+                ok = reader.tryReadUInt8(val);
+                rawVal = val;
+            } else if (bitCount <= 16) {
+                uint16_t val = 0;
+                ok = reader.tryReadUInt16(val, byteOrder);
+                rawVal = val;
+            } else if (bitCount <= 32) {
+                uint32_t val = 0;
+                ok = reader.tryReadUInt32(val, byteOrder);
+                rawVal = val;
+            } else {
+                ok = reader.tryReadUInt64(rawVal, byteOrder);
+            }
+            if (!ok) return DecodeStatus::Truncated;
+            
+            field.setScalar(rawVal);
+            break;
+        }
+        case core::DataType::String: {
+            std::size_t size = fieldDef.stringSize.value_or(0);
+            if (size == 0) {
+                return DecodeStatus::MissingSize;
+            }
+            std::span<const uint8_t> bytes;
+            if (!reader.tryReadBytes(size, bytes)) return DecodeStatus::Truncated;
+            setPayload(bytes, options_.borrowPayloads, *field.payload_);
+            break;
+        }
+        case core::DataType::Bytes: {
+            std::size_t size = fieldDef.arraySize.value_or(0);
+            if (size == 0) {
+                return DecodeStatus::MissingSize;
+            }
+            std::span<const uint8_t> bytes;
+            if (!reader.tryReadBytes(size, bytes)) return DecodeStatus::Truncated;
+            setPayload(bytes, options_.borrowPayloads, *field.payload_);
+            break;
+        }
+        default:
+            return DecodeStatus::UnsupportedType;
+    }
+    
+    return DecodeStatus::Ok;
 }
 
-core::Value Decoder::applyScaling(
-    const core::Value& rawValue,
-    const schema::Scaling& scaling
+DecodeStatus Decoder::decodeVariableField(
+    const FieldPlan& plan,
+    const DecodedPacket& out,
+    core::ByteBufferReader& reader,
+    core::ByteOrder byteOrder,
+    std::size_t& needed,
+    DecodedField& field
 ) const {
-    double raw = 0.0;
-    
-    // Extract numeric value
-    if (std::holds_alternative<int64_t>(rawValue)) {
-        raw = static_cast<double>(std::get<int64_t>(rawValue));
-    } else if (std::holds_alternative<uint64_t>(rawValue)) {
-        raw = static_cast<double>(std::get<uint64_t>(rawValue));
-    } else if (std::holds_alternative<double>(rawValue)) {
-        raw = std::get<double>(rawValue);
+    const auto& fieldDef = *plan.def;
+    describeField(fieldDef, field);
+    
+    // The length field is missing if it failed to decode
+    const auto* length = out.field(schema::FieldHandle{out.id(), static_cast<uint32_t>(*plan.lengthIndex)});
+    if (!length) {
+        return DecodeStatus::InvalidLength;
+    }
+    uint64_t count = 0;
+    const auto raw = length->scalar();
+    if (raw.kind() == core::Scalar::Kind::UInt) {
+        count = raw.asUInt();
+    } else if (raw.kind() == core::Scalar::Kind::Int && raw.asInt() >= 0) {
+        count = static_cast<uint64_t>(raw.asInt());
+    } else {
+        return DecodeStatus::InvalidLength;
+    }
+    
+    const std::size_t elementSize = core::isNumeric(fieldDef.type) ? core::dataTypeSize(fieldDef.type) : 1;
+    const auto limit = fieldDef.type == core::DataType::String ? fieldDef.stringSize : fieldDef.arraySize;
+    if (count > SIZE_MAX / elementSize) {
+        needed = SIZE_MAX;
+        return DecodeStatus::InvalidLength;
+    }
+    needed = static_cast<std::size_t>(count) * elementSize;
+    if (limit && count > *limit) {
+        return DecodeStatus::InvalidLength;
+    }
+    
+    std::span<const uint8_t> bytes;
+    if (!reader.tryReadBytes(needed, bytes)) {
+        return DecodeStatus::Truncated;
+    }
+    if (core::isNumeric(fieldDef.type)) {
+        readElements(fieldDef.type, bytes.data(), static_cast<std::size_t>(count), byteOrder, field.payload_->elements);
+        field.scalePayload();
+    } else {
+        setPayload(bytes, options_.borrowPayloads, *field.payload_);
+    }
+    
+    return DecodeStatus::Ok;
+}
+
+DecodeStatus Decoder::decodePackedField(
+    const schema::Field& fieldDef,
+    core::ByteBufferReader& reader,
+    std::size_t packetStart,
+    std::size_t& bitPos,
+    DecodedField& field
+) const {
+    describeField(fieldDef, field);
+    
+    std::size_t at = fieldDef.bitOffset.value_or(bitPos);
+    std::span<const uint8_t> packet(reader.data() + packetStart, reader.size() - packetStart);
+    core::BitReader bits(packet, at);
+    
+    uint64_t value = 0;
+    if (bits.position() != at || !bits.tryRead(*fieldDef.bitCount, value)) {
+        return DecodeStatus::Truncated;
+    }
+    if (core::isSigned(fieldDef.type)) {
+        field.setScalar(core::signExtend(value, *fieldDef.bitCount));
     } else {
-        // Non-numeric types don't get scaled
-        return rawValue;
+        field.setScalar(value);
     }
     
-    // Apply: scaled = (raw * scale) + offset
-    double scaled = (raw * scaling.scale) + scaling.offset;
-    return scaled;
+    bitPos = at + *fieldDef.bitCount;
+    reader.seek(packetStart + (bitPos + 7) / 8);
+    
+    return DecodeStatus::Ok;
 }
 
-bool Decoder::validateConstraints(
+void Decoder::describeField(const schema::Field& fieldDef, DecodedField& field) const {
+    field.def = &fieldDef;
+    field.type = fieldDef.type;
+    field.scaled = options_.applyScaling && fieldDef.scaling.has_value() && !isPayload(fieldDef.type);
+}
+
+DecodeStatus Decoder::validateConstraints(
     const DecodedField& field,
     const schema::Field& fieldDef,
-    std::string* errorMsg
+    DecodeError* errorOut
 ) const {
-    // Get the scaled value for validation
-    double value = 0.0;
-    bool hasValue = false;
-    
-    const auto& val = field.value();
-    if (std::holds_alternative<int64_t>(val)) {
-        value = static_cast<double>(std::get<int64_t>(val));
-        hasValue = true;
-    } else if (std::holds_alternative<uint64_t>(val)) {
-        value = static_cast<double>(std::get<uint64_t>(val));
-        hasValue = true;
-    } else if (std::holds_alternative<double>(val)) {
-        value = std::get<double>(val);
-        hasValue = true;
-    }
-    
-    if (!hasValue) {
-        return true; // Non-numeric fields don't have constraints
-    }
-    
-    // Check min constraint
-    if (fieldDef.constraints.min.has_value()) {
-        if (value < *fieldDef.constraints.min) {
-            if (errorMsg) {
-                std::ostringstream oss;
-                oss << "Field '" << field.name << "' value " << value
-                    << " is below minimum " << *fieldDef.constraints.min;
-                *errorMsg = oss.str();
-            }
-            return false;
-        }
+    const auto& limits = fieldDef.constraints;
+    if (!limits.min && !limits.max) {
+        return DecodeStatus::Ok;
     }
     
-    // Check max constraint
-    if (fieldDef.constraints.max.has_value()) {
-        if (value > *fieldDef.constraints.max) {
-            if (errorMsg) {
-                std::ostringstream oss;
-                oss << "Field '" << field.name << "' value " << value
-                    << " is above maximum " << *fieldDef.constraints.max;
-                *errorMsg = oss.str();
+    // Limits are in engineering units even when the caller asked for raw
+    // values, unless they asked for raw limits too
+    const bool scaleValues = fieldDef.scaling && (options_.applyScaling || !options_.rawConstraints);
+    auto check = [&](double value) {
+        if (scaleValues) {
+            value = detail::scaled(*fieldDef.scaling, value);
+        }
+        bool below = limits.min && value < *limits.min;
+        bool above = limits.max && value > *limits.max;
+        if (!below && !above) {
+            return DecodeStatus::Ok;
+        }
+        auto status = below ? DecodeStatus::BelowMinimum : DecodeStatus::AboveMaximum;
+        if (errorOut) {
+            *errorOut = DecodeError{};
+            errorOut->code = status;
+            errorOut->value = value;
+            errorOut->limit = below ? *limits.min : *limits.max;
+        }
+        return status;
+    };
+    
+    // Arrays are checked element by element; the first violation is reported
+    auto checkAll = [&](const auto& values) {
+        for (auto value : values) {
+            auto status = check(static_cast<double>(value));
+            if (status != DecodeStatus::Ok) {
+                return status;
             }
-            return false;
         }
+        return DecodeStatus::Ok;
+    };
+    
+    if (auto scalar = field.scalar(); !scalar.empty()) {
+        return check(scalar.toDouble());
+    }
+    if (field.hasPayload_ && core::isNumeric(field.type)) {
+        return std::visit(checkAll, field.payload_->elements);
     }
     
-    return true;
+    return DecodeStatus::Ok; // Non-numeric fields don't have constraints
 }
 
 } // namespace ionet::codec
@@ -0,0 +1,111 @@
+#include "../../include/ionet/codec/PacketDispatch.h"
+#include <algorithm>
+#include <bit>
+
+namespace ionet::codec {
+
+namespace {
+
+// Dense arrays may waste this many slots beyond twice the ID count
+constexpr uint64_t kDenseSlack = 64;
+
+// Largest perfect hash table tried (8 bytes per slot)
+constexpr unsigned kMaxHashBits = 12;
+
+// Multipliers tried per table size
+constexpr int kHashAttempts = 256;
+
+uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+} // anonymous namespace
+
+PacketDispatch::PacketDispatch(std::span<const uint32_t> ids) {
+    if (ids.empty()) {
+        return;
+    }
+    
+    // One entry per ID, the last index winning, so every table shape
+    // agrees on repeated IDs
+    Entries entries;
+    entries.reserve(ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        entries.emplace_back(ids[i], static_cast<uint32_t>(i));
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.first != b.first ? a.first < b.first : a.second > b.second;
+    });
+    entries.erase(std::unique(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.first == b.first;
+    }), entries.end());
+    
+    if (tryDense(entries) || tryPerfectHash(entries)) {
+        return;
+    }
+    sorted_ = std::move(entries);
+    kind_ = Kind::Sorted;
+}
+
+bool PacketDispatch::tryDense(const Entries& entries) {
+    // Entries are sorted by ID
+    uint64_t range = static_cast<uint64_t>(entries.back().first) - entries.front().first + 1;
+    if (range > 2 * entries.size() + kDenseSlack) {
+        return false;
+    }
+
+    base_ = entries.front().first;
+    dense_.assign(static_cast<std::size_t>(range), kNotFound);
+    for (const auto& [id, index] : entries) {
+        dense_[id - base_] = index;
+    }
+    kind_ = Kind::Dense;
+    return true;
+}
+
+bool PacketDispatch::tryPerfectHash(const Entries& entries) {
+    // Start with at least twice as many slots as IDs
+    unsigned bits = static_cast<unsigned>(std::bit_width(2 * entries.size() - 1));
+    uint64_t state = 0;
+
+    for (; bits <= kMaxHashBits; ++bits) {
+        std::vector<Entry> table(std::size_t{1} << bits);
+        shift_ = 64 - bits;
+
+        for (int attempt = 0; attempt < kHashAttempts; ++attempt) {
+            multiplier_ = splitmix64(state) | 1;
+            std::fill(table.begin(), table.end(), Entry{});
+
+            bool collision = false;
+            for (std::size_t i = 0; i < entries.size() && !collision; ++i) {
+                const auto [id, index] = entries[i];
+                Entry& entry = table[hash(id)];
+                if (entry.index != kNotFound) {
+                    collision = true;
+                } else {
+                    entry = {id, index};
+                }
+            }
+            if (!collision) {
+                table_ = std::move(table);
+                kind_ = Kind::PerfectHash;
+                return true;
+            }
+        }
+    }
+
+    multiplier_ = 0;
+    shift_ = 64;
+    return false;
+}
+
+uint32_t PacketDispatch::findSorted(uint32_t id) const {
+    auto it = std::lower_bound(sorted_.begin(), sorted_.end(), id,
+        [](const auto& entry, uint32_t key) { return entry.first < key; });
+    return it != sorted_.end() && it->first == id ? it->second : kNotFound;
+}
+
+} // namespace ionet::codec
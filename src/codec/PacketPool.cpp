@@ -0,0 +1,46 @@
+#include "../../include/ionet/codec/PacketPool.h"
+
+namespace ionet::codec {
+
+void PacketPool::Releaser::operator()(DecodedPacket* packet) const {
+    if (pool) {
+        pool->release(packet);
+    } else {
+        delete packet;
+    }
+}
+
+PacketPool::PacketPool(std::size_t preallocate) {
+    free_.reserve(preallocate);
+    for (std::size_t i = 0; i < preallocate; ++i) {
+        free_.push_back(std::make_unique<DecodedPacket>());
+    }
+}
+
+PacketPool::Handle PacketPool::acquire() {
+    std::unique_ptr<DecodedPacket> packet;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty()) {
+            packet = std::move(free_.back());
+            free_.pop_back();
+        }
+    }
+    if (!packet) {
+        packet = std::make_unique<DecodedPacket>();
+    }
+    return Handle(packet.release(), Releaser{this});
+}
+
+std::size_t PacketPool::available() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return free_.size();
+}
+
+void PacketPool::release(DecodedPacket* packet) {
+    std::unique_ptr<DecodedPacket> owned(packet);
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(std::move(owned));
+}
+
+} // namespace ionet::codec
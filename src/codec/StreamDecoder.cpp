@@ -0,0 +1,207 @@
+#include "../../include/ionet/codec/StreamDecoder.h"
+#include "../../include/ionet/core/Endian.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace ionet::codec {
+
+namespace {
+
+/// Read an unsigned header field from a buffer known to hold the header
+uint64_t readHeaderField(const uint8_t* frame, const schema::HeaderField& field, core::ByteOrder order) {
+    const uint8_t* p = frame + field.offset;
+    switch (field.type) {
+        case core::DataType::UInt16: return core::endian::load<uint16_t>(p, order);
+        case core::DataType::UInt32: return core::endian::load<uint32_t>(p, order);
+        case core::DataType::UInt64: return core::endian::load<uint64_t>(p, order);
+        default: return *p;
+    }
+}
+
+const schema::FrameHeader& requireHeader(const Decoder& decoder) {
+    const auto& header = decoder.schema().frameHeader();
+    if (!header) {
+        throw std::invalid_argument("Schema '" + decoder.schema().info().name + "' declares no frame header");
+    }
+    return *header;
+}
+
+} // anonymous namespace
+
+StreamDecoder::StreamDecoder(const Decoder& decoder, PacketCallback onPacket)
+    : StreamDecoder(decoder, requireHeader(decoder), std::move(onPacket))
+{}
+
+StreamDecoder::StreamDecoder(const Decoder& decoder, schema::FrameHeader header, PacketCallback onPacket)
+    : decoder_(decoder)
+    , header_(std::move(header))
+    , onPacket_(std::move(onPacket))
+{
+    std::string error;
+    if (!header_.validate(&error)) {
+        throw std::invalid_argument(error);
+    }
+    
+    // Longer sync words are searched by prefix; probe() checks the rest
+    if (!header_.sync.empty()) {
+        std::size_t length = std::min(header_.sync.size(), core::SyncScanner::kMaxPattern);
+        scanner_.emplace(std::span<const uint8_t>(header_.sync.data(), length));
+    }
+}
+
+std::size_t StreamDecoder::feed(std::span<const uint8_t> chunk) {
+    std::size_t before = emitted_;
+    stats_.bytesReceived += chunk.size();
+
+    while (!chunk.empty()) {
+        if (!pending_.empty()) {
+            chunk = completePending(chunk);
+        } else {
+            scan(chunk);
+            chunk = {};
+        }
+    }
+
+    return emitted_ - before;
+}
+
+StreamDecoder::Probe StreamDecoder::probe(std::span<const uint8_t> frame) const {
+    // A frame cut short inside the sync word can only be checked so far
+    std::size_t syncBytes = std::min(frame.size(), header_.sync.size());
+    if (!std::equal(header_.sync.begin(), header_.sync.begin() + syncBytes, frame.begin())) {
+        return {Probe::Kind::Invalid};
+    }
+    if (frame.size() < header_.size) {
+        return {Probe::Kind::NeedMore, header_.size};
+    }
+
+    core::ByteOrder order = decoder_.schema().byteOrder();
+    uint64_t id = readHeaderField(frame.data(), header_.id, order);
+    const auto* plan = id <= std::numeric_limits<uint32_t>::max()
+        ? decoder_.compiled().find(static_cast<uint32_t>(id))
+        : nullptr;
+    if (!plan) {
+        return {Probe::Kind::Invalid, 0, static_cast<uint32_t>(id), DecodeStatus::UnknownPacket};
+    }
+
+    int64_t payload = 0;
+    if (header_.length) {
+        payload = static_cast<int64_t>(readHeaderField(frame.data(), *header_.length, order)) +
+            header_.lengthAdjust;
+    } else if (plan->isFixedSize()) {
+        payload = static_cast<int64_t>(plan->size());
+    } else {
+        payload = -1;
+    }
+    if (payload < 0 || static_cast<uint64_t>(payload) > maxPayload_) {
+        return {Probe::Kind::Invalid, static_cast<std::size_t>(std::max<int64_t>(payload, 0)),
+                plan->id(), DecodeStatus::InvalidLength};
+    }
+
+    std::size_t total = header_.size + static_cast<std::size_t>(payload);
+    if (frame.size() < total) {
+        return {Probe::Kind::NeedMore, total, plan->id()};
+    }
+    return {Probe::Kind::Frame, total, plan->id()};
+}
+
+void StreamDecoder::scan(std::span<const uint8_t> data) {
+    std::size_t pos = 0;
+
+    while (pos < data.size()) {
+        std::size_t start = scanner_ ? scanner_->find(data, pos) : pos;
+        if (start != pos) {
+            stats_.bytesSkipped += start - pos;
+            ++stats_.resyncs;
+        }
+        if (start == data.size()) {
+            return;
+        }
+
+        auto result = probe(data.subspan(start));
+        switch (result.kind) {
+            case Probe::Kind::Frame:
+                emit(data.subspan(start, result.length), result.packetId);
+                pos = start + result.length;
+                break;
+            case Probe::Kind::NeedMore:
+                pending_.assign(data.begin() + static_cast<std::ptrdiff_t>(start), data.end());
+                return;
+            case Probe::Kind::Invalid:
+                reject(result);
+                stats_.bytesSkipped += 1;
+                pos = start + 1;
+                break;
+        }
+    }
+}
+
+std::span<const uint8_t> StreamDecoder::completePending(std::span<const uint8_t> chunk) {
+    while (true) {
+        auto result = probe(pending_);
+
+        if (result.kind == Probe::Kind::Frame) {
+            emit(pending_, result.packetId);
+            pending_.clear();
+            return chunk;
+        }
+
+        if (result.kind == Probe::Kind::Invalid) {
+            // The buffered bytes may still hide frames after the bad start
+            reject(result);
+            stats_.bytesSkipped += 1;
+            rescan_.swap(pending_);
+            pending_.clear();
+            scan(std::span<const uint8_t>(rescan_).subspan(1));
+            rescan_.clear();
+            return chunk;
+        }
+
+        if (chunk.empty()) {
+            return chunk;
+        }
+
+        // Take only what the frame still needs; the rest is decoded in place
+        std::size_t take = std::min(result.length - pending_.size(), chunk.size());
+        pending_.insert(pending_.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(take));
+        chunk = chunk.subspan(take);
+    }
+}
+
+void StreamDecoder::emit(std::span<const uint8_t> frame, uint32_t packetId) {
+    DecodeError error;
+    auto status = decoder_.decodeInto(packetId, frame.subspan(header_.size), packet_, &error);
+    if (status != DecodeStatus::Ok) {
+        stats_.errors.record(error);
+        if (onError_) {
+            onError_(error);
+        }
+        return;
+    }
+
+    ++stats_.framesDecoded;
+    ++emitted_;
+    if (onPacket_) {
+        onPacket_(packet_);
+    }
+}
+
+void StreamDecoder::reject(const Probe& probe) {
+    // A sync mismatch is just noise, not a decode error
+    if (probe.error == DecodeStatus::Ok) {
+        return;
+    }
+
+    stats_.errors.record(probe.error);
+    if (onError_) {
+        DecodeError error;
+        error.code = probe.error;
+        error.packetId = probe.packetId;
+        error.packet = decoder_.schema().findPacketById(probe.packetId);
+        error.needed = probe.length;
+        onError_(error);
+    }
+}
+
+} // namespace ionet::codec
@@ -0,0 +1,86 @@
+#include "../../include/ionet/core/Arena.h"
+#include <memory>
+#include <stdexcept>
+
+namespace ionet::core {
+
+namespace {
+
+// Chunks are aligned for any fundamental type
+constexpr std::size_t kChunkAlignment = alignof(std::max_align_t);
+
+} // anonymous namespace
+
+Arena::Arena(std::size_t chunkSize, std::pmr::memory_resource* upstream)
+    : chunkSize_(chunkSize)
+    , upstream_(upstream)
+{
+    if (chunkSize == 0) {
+        throw std::invalid_argument("Arena chunk size must be positive");
+    }
+}
+
+Arena::~Arena() {
+    release();
+}
+
+void Arena::reset() {
+    current_ = 0;
+    used_ = 0;
+    if (chunks_.empty()) {
+        begin_ = next_ = end_ = nullptr;
+    } else {
+        begin_ = next_ = chunks_.front().data;
+        end_ = begin_ + chunks_.front().size;
+    }
+}
+
+void Arena::release() {
+    for (const auto& chunk : chunks_) {
+        upstream_->deallocate(chunk.data, chunk.size, kChunkAlignment);
+    }
+    chunks_.clear();
+    capacity_ = 0;
+    reset();
+}
+
+void* Arena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    void* ptr = next_;
+    std::size_t space = static_cast<std::size_t>(end_ - next_);
+    if (!next_ || !std::align(alignment, bytes, ptr, space)) {
+        advance(bytes, alignment);
+        ptr = next_;
+        space = static_cast<std::size_t>(end_ - next_);
+        std::align(alignment, bytes, ptr, space);
+    }
+    next_ = static_cast<std::byte*>(ptr) + bytes;
+    return ptr;
+}
+
+void Arena::advance(std::size_t bytes, std::size_t alignment) {
+    // Worst case padding when aligning the start of a chunk
+    const std::size_t needed = bytes + (alignment > kChunkAlignment ? alignment : 0);
+
+    if (begin_) {
+        used_ += static_cast<std::size_t>(next_ - begin_);
+    }
+
+    // Reuse a kept chunk if one is big enough; smaller ones are skipped until reset()
+    std::size_t index = begin_ ? current_ + 1 : 0;
+    while (index < chunks_.size() && chunks_[index].size < needed) {
+        ++index;
+    }
+    if (index == chunks_.size()) {
+        Chunk chunk;
+        chunk.size = needed > chunkSize_ ? needed : chunkSize_;
+        chunk.data = static_cast<std::byte*>(upstream_->allocate(chunk.size, kChunkAlignment));
+        chunks_.push_back(chunk);
+        capacity_ += chunk.size;
+    }
+
+    current_ = index;
+    begin_ = next_ = chunks_[index].data;
+    end_ = begin_ + chunks_[index].size;
+}
+
+} // namespace ionet::core
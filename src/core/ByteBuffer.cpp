@@ -13,24 +13,15 @@ void ByteBufferWriter::writeInt8(int8_t value) {
 }
 
 void ByteBufferWriter::writeInt16(int16_t value, ByteOrder order) {
-    uint16_t ordered = endian::convert(static_cast<uint16_t>(value), order);
-    buffer_.push_back(static_cast<uint8_t>(ordered >> 8));
-    buffer_.push_back(static_cast<uint8_t>(ordered & 0xFF));
+    append(static_cast<uint16_t>(value), order);
 }
 
 void ByteBufferWriter::writeInt32(int32_t value, ByteOrder order) {
-    uint32_t ordered = endian::convert(static_cast<uint32_t>(value), order);
-    buffer_.push_back(static_cast<uint8_t>(ordered >> 24));
-    buffer_.push_back(static_cast<uint8_t>(ordered >> 16));
-    buffer_.push_back(static_cast<uint8_t>(ordered >> 8));
-    buffer_.push_back(static_cast<uint8_t>(ordered & 0xFF));
+    append(static_cast<uint32_t>(value), order);
 }
 
 void ByteBufferWriter::writeInt64(int64_t value, ByteOrder order) {
-    uint64_t ordered = endian::convert(static_cast<uint64_t>(value), order);
-    for (int i = 7; i >= 0; --i) {
-        buffer_.push_back(static_cast<uint8_t>(ordered >> (i * 8)));
-    }
+    append(static_cast<uint64_t>(value), order);
 }
 
 void ByteBufferWriter::writeUInt8(uint8_t value) {
@@ -38,24 +29,15 @@ void ByteBufferWriter::writeUInt8(uint8_t value) {
 }
 
 void ByteBufferWriter::writeUInt16(uint16_t value, ByteOrder order) {
-    uint16_t ordered = endian::convert(value, order);
-    buffer_.push_back(static_cast<uint8_t>(ordered >> 8));
-    buffer_.push_back(static_cast<uint8_t>(ordered & 0xFF));
+    append(value, order);
 }
 
 void ByteBufferWriter::writeUInt32(uint32_t value, ByteOrder order) {
-    uint32_t ordered = endian::convert(value, order);
-    buffer_.push_back(static_cast<uint8_t>(ordered >> 24));
-    buffer_.push_back(static_cast<uint8_t>(ordered >> 16));
-    buffer_.push_back(static_cast<uint8_t>(ordered >> 8));
-    buffer_.push_back(static_cast<uint8_t>(ordered & 0xFF));
+    append(value, order);
 }
 
 void ByteBufferWriter::writeUInt64(uint64_t value, ByteOrder order) {
-    uint64_t ordered = endian::convert(value, order);
-    for (int i = 7; i >= 0; --i) {
-        buffer_.push_back(static_cast<uint8_t>(ordered >> (i * 8)));
-    }
+    append(value, order);
 }
 
 void ByteBufferWriter::writeFloat32(float value, ByteOrder order) {
@@ -100,7 +82,7 @@ ByteBufferReader::ByteBufferReader(const std::vector<uint8_t>& data)
     : data_(data.data()), size_(data.size()), pos_(0) {}
 
 void ByteBufferReader::checkRemaining(std::size_t needed) const {
-    if (pos_ + needed > size_) {
+    if (!has(needed)) {
         throw std::runtime_error("Buffer underflow: need " + 
             std::to_string(needed) + " bytes, have " + 
             std::to_string(remaining()));
@@ -113,31 +95,15 @@ int8_t ByteBufferReader::readInt8() {
 }
 
 int16_t ByteBufferReader::readInt16(ByteOrder order) {
-    checkRemaining(2);
-    uint16_t value = (static_cast<uint16_t>(data_[pos_]) << 8) |
-                      static_cast<uint16_t>(data_[pos_ + 1]);
-    pos_ += 2;
-    return static_cast<int16_t>(endian::convert(value, order));
+    return static_cast<int16_t>(readUInt16(order));
 }
 
 int32_t ByteBufferReader::readInt32(ByteOrder order) {
-    checkRemaining(4);
-    uint32_t value = (static_cast<uint32_t>(data_[pos_]) << 24) |
-                     (static_cast<uint32_t>(data_[pos_ + 1]) << 16) |
-                     (static_cast<uint32_t>(data_[pos_ + 2]) << 8) |
-                      static_cast<uint32_t>(data_[pos_ + 3]);
-    pos_ += 4;
-    return static_cast<int32_t>(endian::convert(value, order));
+    return static_cast<int32_t>(readUInt32(order));
 }
 
 int64_t ByteBufferReader::readInt64(ByteOrder order) {
-    checkRemaining(8);
-    uint64_t value = 0;
-    for (int i = 0; i < 8; ++i) {
-        value = (value << 8) | static_cast<uint64_t>(data_[pos_ + i]);
-    }
-    pos_ += 8;
-    return static_cast<int64_t>(endian::convert(value, order));
+    return static_cast<int64_t>(readUInt64(order));
 }
 
 uint8_t ByteBufferReader::readUInt8() {
@@ -147,30 +113,23 @@ uint8_t ByteBufferReader::readUInt8() {
 
 uint16_t ByteBufferReader::readUInt16(ByteOrder order) {
     checkRemaining(2);
-    uint16_t value = (static_cast<uint16_t>(data_[pos_]) << 8) |
-                      static_cast<uint16_t>(data_[pos_ + 1]);
+    uint16_t value = endian::load<uint16_t>(data_ + pos_, order);
     pos_ += 2;
-    return endian::convert(value, order);
+    return value;
 }
 
 uint32_t ByteBufferReader::readUInt32(ByteOrder order) {
     checkRemaining(4);
-    uint32_t value = (static_cast<uint32_t>(data_[pos_]) << 24) |
-                     (static_cast<uint32_t>(data_[pos_ + 1]) << 16) |
-                     (static_cast<uint32_t>(data_[pos_ + 2]) << 8) |
-                      static_cast<uint32_t>(data_[pos_ + 3]);
+    uint32_t value = endian::load<uint32_t>(data_ + pos_, order);
     pos_ += 4;
-    return endian::convert(value, order);
+    return value;
 }
 
 uint64_t ByteBufferReader::readUInt64(ByteOrder order) {
     checkRemaining(8);
-    uint64_t value = 0;
-    for (int i = 0; i < 8; ++i) {
-        value = (value << 8) | static_cast<uint64_t>(data_[pos_ + i]);
-    }
+    uint64_t value = endian::load<uint64_t>(data_ + pos_, order);
     pos_ += 8;
-    return endian::convert(value, order);
+    return value;
 }
 
 float ByteBufferReader::readFloat32(ByteOrder order) {
@@ -201,6 +160,106 @@ std::string ByteBufferReader::readString(std::size_t size) {
     return result;
 }
 
+bool ByteBufferReader::tryReadInt8(int8_t& out) {
+    uint8_t value;
+    if (!tryReadUInt8(value)) {
+        return false;
+    }
+    out = static_cast<int8_t>(value);
+    return true;
+}
+
+bool ByteBufferReader::tryReadInt16(int16_t& out, ByteOrder order) {
+    uint16_t value;
+    if (!tryLoad(value, order)) {
+        return false;
+    }
+    out = static_cast<int16_t>(value);
+    return true;
+}
+
+bool ByteBufferReader::tryReadInt32(int32_t& out, ByteOrder order) {
+    uint32_t value;
+    if (!tryLoad(value, order)) {
+        return false;
+    }
+    out = static_cast<int32_t>(value);
+    return true;
+}
+
+bool ByteBufferReader::tryReadInt64(int64_t& out, ByteOrder order) {
+    uint64_t value;
+    if (!tryLoad(value, order)) {
+        return false;
+    }
+    out = static_cast<int64_t>(value);
+    return true;
+}
+
+bool ByteBufferReader::tryReadUInt8(uint8_t& out) {
+    if (!has(1)) {
+        return false;
+    }
+    out = data_[pos_++];
+    return true;
+}
+
+bool ByteBufferReader::tryReadUInt16(uint16_t& out, ByteOrder order) {
+    return tryLoad(out, order);
+}
+
+bool ByteBufferReader::tryReadUInt32(uint32_t& out, ByteOrder order) {
+    return tryLoad(out, order);
+}
+
+bool ByteBufferReader::tryReadUInt64(uint64_t& out, ByteOrder order) {
+    return tryLoad(out, order);
+}
+
+bool ByteBufferReader::tryReadFloat32(float& out, ByteOrder order) {
+    uint32_t bits;
+    if (!tryLoad(bits, order)) {
+        return false;
+    }
+    std::memcpy(&out, &bits, sizeof(out));
+    return true;
+}
+
+bool ByteBufferReader::tryReadFloat64(double& out, ByteOrder order) {
+    uint64_t bits;
+    if (!tryLoad(bits, order)) {
+        return false;
+    }
+    std::memcpy(&out, &bits, sizeof(out));
+    return true;
+}
+
+bool ByteBufferReader::tryReadBytes(std::size_t count, std::span<const uint8_t>& out) {
+    if (!has(count)) {
+        return false;
+    }
+    out = std::span<const uint8_t>(data_ + pos_, count);
+    pos_ += count;
+    return true;
+}
+
+bool ByteBufferReader::tryReadString(std::size_t size, std::string_view& out) {
+    if (!has(size)) {
+        return false;
+    }
+    out = std::string_view(reinterpret_cast<const char*>(data_ + pos_), size);
+    pos_ += size;
+    return true;
+}
+
+bool ByteBufferReader::trySkip(std::size_t count) {
+    if (!has(count)) {
+        return false;
+    }
+    pos_ += count;
+    return true;
+}
+
 void ByteBufferReader::seek(std::size_t pos) {
     if (pos > size_) {
         throw std::runtime_error("Seek past end of buffer");
@@ -0,0 +1,59 @@
+#include "../../include/ionet/core/FrameSlab.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace ionet::core {
+
+FrameSlab::FrameSlab(std::size_t lanes, std::size_t bytesPerLane)
+    : laneBytes_(bytesPerLane)
+{
+    if (lanes == 0 || bytesPerLane == 0) {
+        throw std::invalid_argument("Frame slab needs at least one non-empty lane");
+    }
+    storage_ = std::make_unique<uint8_t[]>(lanes * bytesPerLane);
+    lanes_.reserve(lanes);
+    for (std::size_t i = 0; i < lanes; ++i) {
+        lanes_.push_back(std::make_unique<Lane>());
+    }
+}
+
+std::optional<FrameDescriptor> FrameSlab::write(uint32_t lane, std::span<const uint8_t> frame, uint32_t tag) {
+    if (frame.size() > laneBytes_) {
+        return std::nullopt;
+    }
+    
+    auto& state = *lanes_[lane];
+    uint64_t position = state.written.load(std::memory_order_relaxed);
+    
+    // Frames are contiguous: skip the rest of the lane if it does not fit
+    std::size_t offset = position % laneBytes_;
+    if (offset + frame.size() > laneBytes_) {
+        position += laneBytes_ - offset;
+        offset = 0;
+    }
+    
+    uint64_t released = state.released.load(std::memory_order_acquire);
+    if (position + frame.size() - released > laneBytes_) {
+        return std::nullopt;
+    }
+    
+    if (!frame.empty()) {
+        std::memcpy(base(lane) + offset, frame.data(), frame.size());
+    }
+    state.written.store(position + frame.size(), std::memory_order_relaxed);
+    
+    FrameDescriptor descriptor;
+    descriptor.position = position;
+    descriptor.length = static_cast<uint32_t>(frame.size());
+    descriptor.tag = tag;
+    descriptor.lane = lane;
+    return descriptor;
+}
+
+std::size_t FrameSlab::used(uint32_t lane) const {
+    const auto& state = *lanes_[lane];
+    return static_cast<std::size_t>(
+        state.written.load(std::memory_order_acquire) - state.released.load(std::memory_order_acquire));
+}
+
+} // namespace ionet::core
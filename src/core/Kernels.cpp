@@ -0,0 +1,658 @@
+#include "../../include/ionet/core/Kernels.h"
+#include "../../include/ionet/core/Endian.h"
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#if defined(IONET_ENABLE_SIMD) && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define IONET_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace ionet::core::kernels {
+
+namespace {
+
+// Elements converted per step when widening through a stack buffer
+constexpr std::size_t kChunk = 256;
+
+// ============ Scalar ============
+
+template<typename U>
+void byteSwapScalar(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        U value;
+        std::memcpy(&value, src + i * sizeof(U), sizeof(U));
+        value = endian::byteSwap(value);
+        std::memcpy(dst + i * sizeof(U), &value, sizeof(U));
+    }
+}
+
+void swap16Scalar(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    byteSwapScalar<uint16_t>(src, dst, count);
+}
+
+void swap32Scalar(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    byteSwapScalar<uint32_t>(src, dst, count);
+}
+
+void swap64Scalar(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    byteSwapScalar<uint64_t>(src, dst, count);
+}
+
+/// memchr for the first byte, then compare the rest. A match cut off by
+/// the end of the data counts, so callers can wait for the remaining bytes.
+std::size_t findSyncScalar(const uint8_t* data, std::size_t size, const uint8_t* pattern, std::size_t length) {
+    for (std::size_t i = 0; i < size; ++i) {
+        const void* hit = std::memchr(data + i, pattern[0], size - i);
+        if (!hit) {
+            break;
+        }
+        i = static_cast<std::size_t>(static_cast<const uint8_t*>(hit) - data);
+        std::size_t avail = (size - i < length) ? size - i : length;
+        if (std::memcmp(data + i, pattern, avail) == 0) {
+            return i;
+        }
+    }
+    return size;
+}
+
+/// Contiguous masks are a shift and AND; anything else is gathered bit by bit
+void extractBitsScalar(uint64_t value, const uint64_t* masks, std::size_t count, uint64_t* out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        uint64_t mask = masks[i];
+        if (mask == 0) {
+            out[i] = 0;
+            continue;
+        }
+        uint64_t low = mask & (~mask + 1);
+        if (((mask + low) & mask) == 0) {
+            out[i] = (value & mask) >> std::countr_zero(mask);
+            continue;
+        }
+        uint64_t result = 0;
+        for (uint64_t bit = 1; mask; bit <<= 1) {
+            if (value & mask & (~mask + 1)) {
+                result |= bit;
+            }
+            mask &= mask - 1;
+        }
+        out[i] = result;
+    }
+}
+
+// ============ x86 ============
+
+#ifdef IONET_X86_KERNELS
+
+// Shuffle controls reversing each 2/4/8-byte element of a 128-bit lane
+#define IONET_SWAP16_MASK 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+#define IONET_SWAP32_MASK 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+#define IONET_SWAP64_MASK 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8
+
+__attribute__((target("ssse3")))
+void shuffleSsse3(const uint8_t* src, uint8_t* dst, std::size_t bytes, __m128i mask) {
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+    }
+}
+
+__attribute__((target("ssse3")))
+void swap16Ssse3(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    std::size_t bulk = count & ~std::size_t{7};
+    shuffleSsse3(src, dst, bulk * 2, _mm_setr_epi8(IONET_SWAP16_MASK));
+    byteSwapScalar<uint16_t>(src + bulk * 2, dst + bulk * 2, count - bulk);
+}
+
+__attribute__((target("ssse3")))
+void swap32Ssse3(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    std::size_t bulk = count & ~std::size_t{3};
+    shuffleSsse3(src, dst, bulk * 4, _mm_setr_epi8(IONET_SWAP32_MASK));
+    byteSwapScalar<uint32_t>(src + bulk * 4, dst + bulk * 4, count - bulk);
+}
+
+__attribute__((target("ssse3")))
+void swap64Ssse3(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    std::size_t bulk = count & ~std::size_t{1};
+    shuffleSsse3(src, dst, bulk * 8, _mm_setr_epi8(IONET_SWAP64_MASK));
+    byteSwapScalar<uint64_t>(src + bulk * 8, dst + bulk * 8, count - bulk);
+}
+
+// Unsigned 32-bit lanes convert as signed after flipping the top bit,
+// then get 2^31 back; every step is exact
+constexpr double kTwo31 = 2147483648.0;
+
+/// Scale four int32 lanes (two cvtepi32_pd halves) into out[0..3]
+__attribute__((target("ssse3")))
+void scaleLanesSsse3(__m128i w, bool isUnsigned, __m128d vs, __m128d vo, double* out) {
+    if (isUnsigned) {
+        w = _mm_xor_si128(w, _mm_set1_epi32(INT32_MIN));
+    }
+    __m128d lo = _mm_cvtepi32_pd(w);
+    __m128d hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(w, _MM_SHUFFLE(1, 0, 3, 2)));
+    if (isUnsigned) {
+        lo = _mm_add_pd(lo, _mm_set1_pd(kTwo31));
+        hi = _mm_add_pd(hi, _mm_set1_pd(kTwo31));
+    }
+    _mm_storeu_pd(out, _mm_add_pd(_mm_mul_pd(lo, vs), vo));
+    _mm_storeu_pd(out + 2, _mm_add_pd(_mm_mul_pd(hi, vs), vo));
+}
+
+/// Swap, widen to int32 (no SSE4.1: unpack, then shift in the sign) and
+/// scale four 16-bit elements per step. Returns the elements converted.
+__attribute__((target("ssse3")))
+std::size_t scale16Ssse3(const uint8_t* src, std::size_t count, bool swap, bool isSigned,
+                         double scale, double offset, double* out) {
+    const __m128i mask = _mm_setr_epi8(IONET_SWAP16_MASK);
+    const __m128d vs = _mm_set1_pd(scale);
+    const __m128d vo = _mm_set1_pd(offset);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i * 2));
+        if (swap) {
+            v = _mm_shuffle_epi8(v, mask);
+        }
+        __m128i w = isSigned ? _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)
+                             : _mm_unpacklo_epi16(v, _mm_setzero_si128());
+        scaleLanesSsse3(w, false, vs, vo, out + i);
+    }
+    return i;
+}
+
+__attribute__((target("ssse3")))
+std::size_t scale32Ssse3(const uint8_t* src, std::size_t count, bool swap, bool isSigned,
+                         double scale, double offset, double* out) {
+    const __m128i mask = _mm_setr_epi8(IONET_SWAP32_MASK);
+    const __m128d vs = _mm_set1_pd(scale);
+    const __m128d vo = _mm_set1_pd(offset);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        if (swap) {
+            v = _mm_shuffle_epi8(v, mask);
+        }
+        scaleLanesSsse3(v, !isSigned, vs, vo, out + i);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+void shuffleAvx2(const uint8_t* src, uint8_t* dst, std::size_t bytes, __m256i mask) {
+    std::size_t i = 0;
+    for (; i + 32 <= bytes; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(v, mask));
+    }
+}
+
+__attribute__((target("avx2")))
+void swap16Avx2(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    std::size_t bulk = count & ~std::size_t{15};
+    shuffleAvx2(src, dst, bulk * 2,
+        _mm256_setr_epi8(IONET_SWAP16_MASK, IONET_SWAP16_MASK));
+    byteSwapScalar<uint16_t>(src + bulk * 2, dst + bulk * 2, count - bulk);
+}
+
+__attribute__((target("avx2")))
+void swap32Avx2(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    std::size_t bulk = count & ~std::size_t{7};
+    shuffleAvx2(src, dst, bulk * 4,
+        _mm256_setr_epi8(IONET_SWAP32_MASK, IONET_SWAP32_MASK));
+    byteSwapScalar<uint32_t>(src + bulk * 4, dst + bulk * 4, count - bulk);
+}
+
+__attribute__((target("avx2")))
+void swap64Avx2(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    std::size_t bulk = count & ~std::size_t{3};
+    shuffleAvx2(src, dst, bulk * 8,
+        _mm256_setr_epi8(IONET_SWAP64_MASK, IONET_SWAP64_MASK));
+    byteSwapScalar<uint64_t>(src + bulk * 8, dst + bulk * 8, count - bulk);
+}
+
+/// Swap and sign/zero-extend four 16-bit or 32-bit elements per step.
+/// Returns the number of elements converted; the caller finishes the tail.
+__attribute__((target("avx2")))
+std::size_t widen16Avx2(const uint8_t* src, std::size_t count, bool swap, bool isSigned, int64_t* out) {
+    const __m128i mask = _mm_setr_epi8(IONET_SWAP16_MASK);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i * 2));
+        if (swap) {
+            v = _mm_shuffle_epi8(v, mask);
+        }
+        __m256i w = isSigned ? _mm256_cvtepi16_epi64(v) : _mm256_cvtepu16_epi64(v);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), w);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+std::size_t widen32Avx2(const uint8_t* src, std::size_t count, bool swap, bool isSigned, int64_t* out) {
+    const __m128i mask = _mm_setr_epi8(IONET_SWAP32_MASK);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        if (swap) {
+            v = _mm_shuffle_epi8(v, mask);
+        }
+        __m256i w = isSigned ? _mm256_cvtepi32_epi64(v) : _mm256_cvtepu32_epi64(v);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), w);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+std::size_t widenFloatAvx2(const uint8_t* src, std::size_t count, bool swap, double* out) {
+    const __m128i mask = _mm_setr_epi8(IONET_SWAP32_MASK);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        if (swap) {
+            v = _mm_shuffle_epi8(v, mask);
+        }
+        _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm_castsi128_ps(v)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+std::size_t scaleAvx2(const double* in, std::size_t count, double scale, double offset, double* out) {
+    const __m256d vs = _mm256_set1_pd(scale);
+    const __m256d vo = _mm256_set1_pd(offset);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d x = _mm256_loadu_pd(in + i);
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_mul_pd(x, vs), vo));
+    }
+    return i;
+}
+
+/// Swap, widen to int32 and scale four 16-bit or 32-bit elements per step
+/// (cvtepi32_pd); the caller finishes the tail
+__attribute__((target("avx2")))
+std::size_t scale16Avx2(const uint8_t* src, std::size_t count, bool swap, bool isSigned,
+                        double scale, double offset, double* out) {
+    const __m128i mask = _mm_setr_epi8(IONET_SWAP16_MASK);
+    const __m256d vs = _mm256_set1_pd(scale);
+    const __m256d vo = _mm256_set1_pd(offset);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i * 2));
+        if (swap) {
+            v = _mm_shuffle_epi8(v, mask);
+        }
+        __m128i w = isSigned ? _mm_cvtepi16_epi32(v) : _mm_cvtepu16_epi32(v);
+        __m256d x = _mm256_cvtepi32_pd(w);
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_mul_pd(x, vs), vo));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+std::size_t scale32Avx2(const uint8_t* src, std::size_t count, bool swap, bool isSigned,
+                        double scale, double offset, double* out) {
+    const __m128i mask = _mm_setr_epi8(IONET_SWAP32_MASK);
+    const __m256d vs = _mm256_set1_pd(scale);
+    const __m256d vo = _mm256_set1_pd(offset);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        if (swap) {
+            v = _mm_shuffle_epi8(v, mask);
+        }
+        __m256d x;
+        if (isSigned) {
+            x = _mm256_cvtepi32_pd(v);
+        } else {
+            x = _mm256_cvtepi32_pd(_mm_xor_si128(v, _mm_set1_epi32(INT32_MIN)));
+            x = _mm256_add_pd(x, _mm256_set1_pd(kTwo31));
+        }
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_mul_pd(x, vs), vo));
+    }
+    return i;
+}
+
+// Sync search: a candidate must match both the first and the last pattern
+// byte, which rejects almost all noise without touching the middle bytes.
+// Returns the first full match, or where the vector loop stopped so the
+// scalar search can finish the tail (including cut-off matches).
+
+__attribute__((target("sse2")))
+std::size_t findSyncSse2(const uint8_t* data, std::size_t size, const uint8_t* pattern, std::size_t length) {
+    const __m128i first = _mm_set1_epi8(static_cast<char>(pattern[0]));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(pattern[length - 1]));
+    std::size_t i = 0;
+    for (; i + 16 + length - 1 <= size; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + length - 1));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+        while (mask) {
+            std::size_t at = i + static_cast<std::size_t>(std::countr_zero(mask));
+            if (std::memcmp(data + at, pattern, length) == 0) {
+                return at;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return i + findSyncScalar(data + i, size - i, pattern, length);
+}
+
+__attribute__((target("avx2")))
+std::size_t findSyncAvx2(const uint8_t* data, std::size_t size, const uint8_t* pattern, std::size_t length) {
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(pattern[0]));
+    const __m256i last = _mm256_set1_epi8(static_cast<char>(pattern[length - 1]));
+    std::size_t i = 0;
+    for (; i + 32 + length - 1 <= size; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + length - 1));
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+        while (mask) {
+            std::size_t at = i + static_cast<std::size_t>(std::countr_zero(mask));
+            if (std::memcmp(data + at, pattern, length) == 0) {
+                return at;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return i + findSyncSse2(data + i, size - i, pattern, length);
+}
+
+// PEXT is microcoded (slow) on AMD before Zen 3; still correct there
+__attribute__((target("bmi2")))
+void extractBitsBmi2(uint64_t value, const uint64_t* masks, std::size_t count, uint64_t* out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = _pext_u64(value, masks[i]);
+    }
+}
+
+#endif // IONET_X86_KERNELS
+
+// ============ Dispatch ============
+
+using SwapFn = void (*)(const uint8_t*, uint8_t*, std::size_t);
+using FindFn = std::size_t (*)(const uint8_t*, std::size_t, const uint8_t*, std::size_t);
+using ExtractFn = void (*)(uint64_t, const uint64_t*, std::size_t, uint64_t*);
+
+struct Dispatch {
+    KernelSet set = KernelSet::Scalar;
+    SwapFn swap16 = swap16Scalar;
+    SwapFn swap32 = swap32Scalar;
+    SwapFn swap64 = swap64Scalar;
+    FindFn findSync = findSyncScalar;
+    ExtractFn extractBits = extractBitsScalar;
+    bool pext = false;
+};
+
+Dispatch selectKernels() {
+    Dispatch d;
+#ifdef IONET_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        d.set = KernelSet::AVX2;
+        d.swap16 = swap16Avx2;
+        d.swap32 = swap32Avx2;
+        d.swap64 = swap64Avx2;
+        d.findSync = findSyncAvx2;
+    } else if (__builtin_cpu_supports("ssse3")) {
+        d.set = KernelSet::SSSE3;
+        d.swap16 = swap16Ssse3;
+        d.swap32 = swap32Ssse3;
+        d.swap64 = swap64Ssse3;
+        d.findSync = findSyncSse2;
+    }
+    if (__builtin_cpu_supports("bmi2")) {
+        d.extractBits = extractBitsBmi2;
+        d.pext = true;
+    }
+#endif
+    return d;
+}
+
+const Dispatch& kernels() {
+    static const Dispatch dispatch = selectKernels();
+    return dispatch;
+}
+
+/// Swap (if needed) through a stack buffer, then widen each element
+template<typename U, typename Out>
+void widenChunked(const uint8_t* src, std::size_t count, bool swap, Out* out) {
+    using Src = std::conditional_t<std::is_signed_v<Out>, std::make_signed_t<U>, U>;
+    alignas(32) uint8_t buffer[kChunk * sizeof(U)];
+
+    for (std::size_t done = 0; done < count; done += kChunk) {
+        std::size_t n = (count - done < kChunk) ? count - done : kChunk;
+        const uint8_t* chunk = src + done * sizeof(U);
+        if (swap) {
+            if constexpr (sizeof(U) == 2) kernels().swap16(chunk, buffer, n);
+            if constexpr (sizeof(U) == 4) kernels().swap32(chunk, buffer, n);
+            chunk = buffer;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            Src value;
+            std::memcpy(&value, chunk + i * sizeof(U), sizeof(U));
+            out[done + i] = static_cast<Out>(value);
+        }
+    }
+}
+
+/// Copy 8-byte elements, swapping if needed
+void copy64(const uint8_t* src, std::size_t count, bool swap, void* out) {
+    if (swap) {
+        kernels().swap64(src, static_cast<uint8_t*>(out), count);
+    } else if (count) {
+        std::memmove(out, src, count * 8);  // Empty runs may be null
+    }
+}
+
+template<typename Out>
+void toInteger(DataType type, const uint8_t* src, std::size_t count, ByteOrder order, Out* out) {
+    const bool swap = endian::needsSwap(order);
+    const std::size_t width = dataTypeSize(type);
+
+    if (width == 1) {
+        using Src = std::conditional_t<std::is_signed_v<Out>, int8_t, uint8_t>;
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<Src>(src[i]);
+        }
+        return;
+    }
+    if (width == 8) {
+        copy64(src, count, swap, out);
+        return;
+    }
+
+    std::size_t done = 0;
+#ifdef IONET_X86_KERNELS
+    if (kernels().set == KernelSet::AVX2) {
+        // Two's complement: the signed widening result reinterprets losslessly
+        auto* wide = reinterpret_cast<int64_t*>(out);
+        done = (width == 2)
+            ? widen16Avx2(src, count, swap, std::is_signed_v<Out>, wide)
+            : widen32Avx2(src, count, swap, std::is_signed_v<Out>, wide);
+    }
+#endif
+    if (width == 2) {
+        widenChunked<uint16_t>(src + done * 2, count - done, swap, out + done);
+    } else {
+        widenChunked<uint32_t>(src + done * 4, count - done, swap, out + done);
+    }
+}
+
+template<typename T>
+void scaleScalar(const T* in, std::size_t count, double scale, double offset, double* out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = (static_cast<double>(in[i]) * scale) + offset;
+    }
+}
+
+// Unsigned arithmetic wraps instead of overflowing
+template<typename T>
+void scaleFixedScalar(const T* in, std::size_t count, int64_t multiplier, int64_t bias, int64_t* out) {
+    const auto m = static_cast<uint64_t>(multiplier);
+    const auto b = static_cast<uint64_t>(bias);
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<int64_t>(static_cast<uint64_t>(in[i]) * m + b);
+    }
+}
+
+} // anonymous namespace
+
+KernelSet activeKernelSet() {
+    return kernels().set;
+}
+
+const char* kernelSetName(KernelSet set) {
+    switch (set) {
+        case KernelSet::Scalar: return "scalar";
+        case KernelSet::SSSE3:  return "ssse3";
+        case KernelSet::AVX2:   return "avx2";
+    }
+    return "unknown";
+}
+
+void byteSwap16(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    kernels().swap16(src, dst, count);
+}
+
+void byteSwap32(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    kernels().swap32(src, dst, count);
+}
+
+void byteSwap64(const uint8_t* src, uint8_t* dst, std::size_t count) {
+    kernels().swap64(src, dst, count);
+}
+
+void toInt64(DataType type, const uint8_t* src, std::size_t count, ByteOrder order, int64_t* out) {
+    toInteger(type, src, count, order, out);
+}
+
+void toUInt64(DataType type, const uint8_t* src, std::size_t count, ByteOrder order, uint64_t* out) {
+    toInteger(type, src, count, order, out);
+}
+
+void toDouble(DataType type, const uint8_t* src, std::size_t count, ByteOrder order, double* out) {
+    const bool swap = endian::needsSwap(order);
+
+    if (type == DataType::Float64) {
+        copy64(src, count, swap, out);
+        return;
+    }
+
+    std::size_t done = 0;
+#ifdef IONET_X86_KERNELS
+    if (kernels().set == KernelSet::AVX2) {
+        done = widenFloatAvx2(src, count, swap, out);
+    }
+#endif
+    for (std::size_t i = done; i < count; ++i) {
+        uint32_t bits = endian::loadSwapped<uint32_t>(src + i * 4, swap);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        out[i] = static_cast<double>(value);
+    }
+}
+
+void toScaled(DataType type, const uint8_t* src, std::size_t count, ByteOrder order,
+              double scale, double offset, double* out) {
+    const std::size_t width = dataTypeSize(type);
+    if (!isInteger(type)) {
+        toDouble(type, src, count, order, out);
+        kernels::scale(out, count, scale, offset, out);
+        return;
+    }
+    if (width != 2 && width != 4) {
+        // 8-bit gains nothing over the widening path; 64-bit has no narrower form
+        alignas(32) int64_t wide[kChunk];
+        for (std::size_t done = 0; done < count; done += kChunk) {
+            std::size_t n = (count - done < kChunk) ? count - done : kChunk;
+            const uint8_t* chunk = src + done * width;
+            if (isSigned(type)) {
+                toInt64(type, chunk, n, order, wide);
+                scaleScalar(wide, n, scale, offset, out + done);
+            } else {
+                auto* uwide = reinterpret_cast<uint64_t*>(wide);
+                toUInt64(type, chunk, n, order, uwide);
+                scaleScalar(uwide, n, scale, offset, out + done);
+            }
+        }
+        return;
+    }
+
+    const bool swap = endian::needsSwap(order);
+    const bool isSigned = core::isSigned(type);
+    std::size_t done = 0;
+#ifdef IONET_X86_KERNELS
+    if (kernels().set == KernelSet::AVX2) {
+        done = (width == 2)
+            ? scale16Avx2(src, count, swap, isSigned, scale, offset, out)
+            : scale32Avx2(src, count, swap, isSigned, scale, offset, out);
+    } else if (kernels().set == KernelSet::SSSE3) {
+        done = (width == 2)
+            ? scale16Ssse3(src, count, swap, isSigned, scale, offset, out)
+            : scale32Ssse3(src, count, swap, isSigned, scale, offset, out);
+    }
+#endif
+    for (std::size_t i = done; i < count; ++i) {
+        double value;
+        if (width == 2) {
+            auto bits = endian::loadSwapped<uint16_t>(src + i * 2, swap);
+            value = isSigned ? static_cast<double>(static_cast<int16_t>(bits)) : static_cast<double>(bits);
+        } else {
+            auto bits = endian::loadSwapped<uint32_t>(src + i * 4, swap);
+            value = isSigned ? static_cast<double>(static_cast<int32_t>(bits)) : static_cast<double>(bits);
+        }
+        out[i] = (value * scale) + offset;
+    }
+}
+
+// AVX2 has no packed int64 -> double conversion, so widened integers stay
+// scalar; packed 16/32-bit input converts narrow through toScaled()
+void scale(const int64_t* in, std::size_t count, double scale, double offset, double* out) {
+    scaleScalar(in, count, scale, offset, out);
+}
+
+void scale(const uint64_t* in, std::size_t count, double scale, double offset, double* out) {
+    scaleScalar(in, count, scale, offset, out);
+}
+
+void scale(const double* in, std::size_t count, double scale, double offset, double* out) {
+    std::size_t done = 0;
+#ifdef IONET_X86_KERNELS
+    if (kernels().set == KernelSet::AVX2) {
+        done = scaleAvx2(in, count, scale, offset, out);
+    }
+#endif
+    scaleScalar(in + done, count - done, scale, offset, out + done);
+}
+
+// Plain loops: AVX2 has no packed 64-bit multiply, and compilers vectorize
+// these where the target does (AVX-512DQ)
+void scaleFixed(const int64_t* in, std::size_t count, int64_t multiplier, int64_t bias, int64_t* out) {
+    scaleFixedScalar(in, count, multiplier, bias, out);
+}
+
+void scaleFixed(const uint64_t* in, std::size_t count, int64_t multiplier, int64_t bias, int64_t* out) {
+    scaleFixedScalar(in, count, multiplier, bias, out);
+}
+
+std::size_t findSync(const uint8_t* data, std::size_t size, const uint8_t* pattern, std::size_t length) {
+    if (length == 0) {
+        return 0;
+    }
+    return kernels().findSync(data, size, pattern, length);
+}
+
+void extractBits(uint64_t value, const uint64_t* masks, std::size_t count, uint64_t* out) {
+    kernels().extractBits(value, masks, count, out);
+}
+
+bool hasPext() {
+    return kernels().pext;
+}
+
+} // namespace ionet::core::kernels
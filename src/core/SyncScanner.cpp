@@ -0,0 +1,46 @@
+#include "../../include/ionet/core/SyncScanner.h"
+#include "../../include/ionet/core/Kernels.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace ionet::core {
+
+SyncScanner::SyncScanner(std::span<const uint8_t> pattern) {
+    if (pattern.empty() || pattern.size() > kMaxPattern) {
+        throw std::invalid_argument("Sync pattern must be 1-4 bytes, got " + std::to_string(pattern.size()));
+    }
+    std::copy(pattern.begin(), pattern.end(), pattern_.begin());
+    length_ = pattern.size();
+}
+
+std::size_t SyncScanner::find(std::span<const uint8_t> data, std::size_t from) const {
+    if (from >= data.size()) {
+        return data.size();
+    }
+    return from + kernels::findSync(data.data() + from, data.size() - from, pattern_.data(), length_);
+}
+
+bool SyncScanner::resync(ByteBufferReader& reader) {
+    std::span<const uint8_t> data(reader.data(), reader.size());
+    std::size_t from = reader.position();
+    std::size_t at = find(data, from);
+
+    record(at - from);
+    reader.seek(at);
+    return reader.has(length_);
+}
+
+void SyncScanner::record(std::size_t skipped) {
+    if (skipped > 0) {
+        bytesSkipped_ += skipped;
+        ++resyncs_;
+    }
+}
+
+void SyncScanner::resetStats() {
+    bytesSkipped_ = 0;
+    resyncs_ = 0;
+}
+
+} // namespace ionet::core
@@ -17,6 +17,31 @@ ir::IRBitFlag parseIRBitFlag(const json& j) {
     return flag;
 }
 
+ir::IRSubfield parseIRSubfield(const json& j) {
+    ir::IRSubfield sub;
+    sub.name = j["name"].get<std::string>();
+    sub.bit = j["bit"].get<uint8_t>();
+    sub.width = j["width"].get<uint8_t>();
+    if (j.contains("description")) {
+        sub.description = j["description"].get<std::string>();
+    }
+    if (j.contains("unit")) {
+        sub.unit = j["unit"].get<std::string>();
+    }
+    if (j.contains("scale")) {
+        sub.scaling.scale = j["scale"].get<double>();
+    }
+    if (j.contains("offset")) {
+        sub.scaling.offset = j["offset"].get<double>();
+    }
+    if (j.contains("enum")) {
+        for (const auto& labelJson : j["enum"]) {
+            sub.labels.push_back({labelJson["value"].get<uint64_t>(), labelJson["name"].get<std::string>()});
+        }
+    }
+    return sub;
+}
+
 ir::IRField parseIRField(const json& j) {
     ir::IRField field;
     
@@ -57,16 +82,27 @@ ir::IRField parseIRField(const json& j) {
     if (j.contains("bits")) {
         field.bitCount = j["bits"].get<uint8_t>();
     }
+    if (j.contains("bit_offset")) {
+        field.bitOffset = j["bit_offset"].get<std::size_t>();
+    }
     if (j.contains("flags")) {
         for (const auto& flagJson : j["flags"]) {
             field.bitFlags.push_back(parseIRBitFlag(flagJson));
         }
     }
+    if (j.contains("subfields")) {
+        for (const auto& subJson : j["subfields"]) {
+            field.subfields.push_back(parseIRSubfield(subJson));
+        }
+    }
     
     // Size
     if (j.contains("size")) {
         field.size = j["size"].get<std::size_t>();
     }
+    if (j.contains("length_field")) {
+        field.lengthField = j["length_field"].get<std::string>();
+    }
     
     return field;
 }
@@ -99,6 +135,51 @@ ir::IRPacket parseIRPacket(const json& j) {
     return packet;
 }
 
+ir::IRHeaderField parseIRHeaderField(const json& j, const char* what) {
+    ir::IRHeaderField field;
+    if (!j.contains("offset")) {
+        throw std::runtime_error(std::string("Frame ") + what + " missing 'offset'");
+    }
+    field.offset = j["offset"].get<std::size_t>();
+    field.type = j.contains("type") ? j["type"].get<std::string>() : "uint8";
+    return field;
+}
+
+ir::IRFrameHeader parseIRFrameHeader(const json& j) {
+    ir::IRFrameHeader frame;
+    
+    if (j.contains("sync")) {
+        for (const auto& byteJson : j["sync"]) {
+            if (!byteJson.is_number_integer()) {
+                throw std::runtime_error("Frame sync value " + byteJson.dump() + " is not a byte (0-255)");
+            }
+            auto value = byteJson.get<int64_t>();
+            if (value < 0 || value > 0xFF) {
+                throw std::runtime_error("Frame sync value " + std::to_string(value) + " is not a byte (0-255)");
+            }
+            frame.sync.push_back(static_cast<uint8_t>(value));
+        }
+    }
+    
+    if (!j.contains("id")) {
+        throw std::runtime_error("Frame header missing 'id'");
+    }
+    frame.id = parseIRHeaderField(j["id"], "id");
+    
+    if (j.contains("length")) {
+        frame.length = parseIRHeaderField(j["length"], "length");
+        if (j["length"].contains("adjust")) {
+            frame.lengthAdjust = j["length"]["adjust"].get<int64_t>();
+        }
+    }
+    
+    if (j.contains("size")) {
+        frame.size = j["size"].get<std::size_t>();
+    }
+    
+    return frame;
+}
+
 } // anonymous namespace
 
 ir::IRSchema JsonSchemaParser::parseToIR(std::string_view content) {
@@ -121,6 +202,9 @@ ir::IRSchema JsonSchemaParser::parseToIR(std::string_view content) {
         if (schemaJson.contains("byte_order")) {
             ir.info.byteOrder = schemaJson["byte_order"].get<std::string>();
         }
+        if (schemaJson.contains("frame")) {
+            ir.frame = parseIRFrameHeader(schemaJson["frame"]);
+        }
     }
     
     // Parse packets
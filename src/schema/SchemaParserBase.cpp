@@ -1,4 +1,5 @@
 #include "../../include/ionet/schema/SchemaParser.h"
+#include <algorithm>
 #include <stdexcept>
 
 namespace ionet::schema {
@@ -16,6 +17,7 @@ core::DataType SchemaParserBase::parseDataType(const std::string& typeStr) {
     if (typeStr == "float64")  return core::DataType::Float64;
     if (typeStr == "bitfield") return core::DataType::Bitfield;
     if (typeStr == "string")   return core::DataType::String;
+    if (typeStr == "bytes")    return core::DataType::Bytes;
     
     throw std::runtime_error("Unknown data type: " + typeStr);
 }
@@ -41,7 +43,15 @@ Field SchemaParserBase::buildField(const ir::IRField& irField) {
     Field field;
     
     field.name = irField.name;
-    field.type = parseDataType(irField.type);
+    // "int16[64]" declares a fixed-length array of 64 int16 elements
+    std::string typeName = irField.type;
+    std::optional<std::size_t> arrayLength;
+    auto open = typeName.find('[');
+    if (open != std::string::npos && typeName.back() == ']') {
+        arrayLength = std::stoul(typeName.substr(open + 1, typeName.size() - open - 2));
+        typeName.resize(open);
+    }
+    field.type = parseDataType(typeName);
     field.description = irField.description;
     field.unit = irField.unit;
     
@@ -61,6 +71,7 @@ Field SchemaParserBase::buildField(const ir::IRField& irField) {
     if (irField.bitCount.has_value()) {
         field.bitCount = irField.bitCount.value();
     }
+    field.bitOffset = irField.bitOffset;
     
     for (const auto& irFlag : irField.bitFlags) {
         BitFlag flag;
@@ -70,6 +81,24 @@ Field SchemaParserBase::buildField(const ir::IRField& irField) {
         field.bitFlags.push_back(std::move(flag));
     }
     
+    for (const auto& irSub : irField.subfields) {
+        BitSubfield sub;
+        sub.bit = irSub.bit;
+        sub.width = irSub.width;
+        sub.name = irSub.name;
+        sub.description = irSub.description;
+        if (!irSub.unit.empty()) {
+            sub.unit = irSub.unit;
+        }
+        if (irSub.scaling.scale.has_value() || irSub.scaling.offset.has_value()) {
+            sub.scaling = Scaling{irSub.scaling.scale.value_or(1.0), irSub.scaling.offset.value_or(0.0)};
+        }
+        for (const auto& irLabel : irSub.labels) {
+            sub.labels.push_back(EnumLabel{irLabel.value, irLabel.name});
+        }
+        field.subfields.push_back(std::move(sub));
+    }
+    
     // Size (for strings/arrays)
     if (irField.size.has_value()) {
         if (field.type == core::DataType::String) {
@@ -78,6 +107,10 @@ Field SchemaParserBase::buildField(const ir::IRField& irField) {
             field.arraySize = irField.size.value();
         }
     }
+    if (arrayLength) {
+        field.arraySize = arrayLength;
+    }
+    field.lengthField = irField.lengthField;
     
     return field;
 }
@@ -96,6 +129,31 @@ Packet SchemaParserBase::buildPacket(const ir::IRPacket& irPacket) {
     return packet;
 }
 
+FrameHeader SchemaParserBase::buildFrameHeader(const ir::IRFrameHeader& irFrame) {
+    FrameHeader header;
+    
+    header.sync = irFrame.sync;
+    header.id.offset = irFrame.id.offset;
+    header.id.type = parseDataType(irFrame.id.type);
+    
+    if (irFrame.length.has_value()) {
+        HeaderField length;
+        length.offset = irFrame.length->offset;
+        length.type = parseDataType(irFrame.length->type);
+        header.length = length;
+    }
+    header.lengthAdjust = irFrame.lengthAdjust;
+    
+    // Without an explicit size the header ends after its last field
+    header.size = irFrame.size.value_or(std::max({
+        header.sync.size(),
+        header.id.end(),
+        header.length ? header.length->end() : 0
+    }));
+    
+    return header;
+}
+
 core::Result<Schema> SchemaParserBase::buildSchema(const ir::IRSchema& ir) {
     try {
         Schema schema;
@@ -112,6 +170,11 @@ core::Result<Schema> SchemaParserBase::buildSchema(const ir::IRSchema& ir) {
             schema.setByteOrder(parseByteOrder(ir.info.byteOrder));
         }
         
+        // Stream framing
+        if (ir.frame.has_value()) {
+            schema.setFrameHeader(buildFrameHeader(*ir.frame));
+        }
+        
         // Packets
         for (const auto& irPacket : ir.packets) {
             schema.addPacket(buildPacket(irPacket));
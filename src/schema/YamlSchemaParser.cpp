@@ -15,6 +15,31 @@ ir::IRBitFlag parseIRBitFlag(const YAML::Node& node) {
     return flag;
 }
 
+ir::IRSubfield parseIRSubfield(const YAML::Node& node) {
+    ir::IRSubfield sub;
+    sub.name = node["name"].as<std::string>();
+    sub.bit = node["bit"].as<uint8_t>();
+    sub.width = node["width"].as<uint8_t>();
+    if (node["description"]) {
+        sub.description = node["description"].as<std::string>();
+    }
+    if (node["unit"]) {
+        sub.unit = node["unit"].as<std::string>();
+    }
+    if (node["scale"]) {
+        sub.scaling.scale = node["scale"].as<double>();
+    }
+    if (node["offset"]) {
+        sub.scaling.offset = node["offset"].as<double>();
+    }
+    if (node["enum"]) {
+        for (const auto& labelNode : node["enum"]) {
+            sub.labels.push_back({labelNode["value"].as<uint64_t>(), labelNode["name"].as<std::string>()});
+        }
+    }
+    return sub;
+}
+
 ir::IRField parseIRField(const YAML::Node& node) {
     ir::IRField field;
     
@@ -55,16 +80,27 @@ ir::IRField parseIRField(const YAML::Node& node) {
     if (node["bits"]) {
         field.bitCount = node["bits"].as<uint8_t>();
     }
+    if (node["bit_offset"]) {
+        field.bitOffset = node["bit_offset"].as<std::size_t>();
+    }
     if (node["flags"]) {
         for (const auto& flagNode : node["flags"]) {
             field.bitFlags.push_back(parseIRBitFlag(flagNode));
         }
     }
+    if (node["subfields"]) {
+        for (const auto& subNode : node["subfields"]) {
+            field.subfields.push_back(parseIRSubfield(subNode));
+        }
+    }
     
     // Size
     if (node["size"]) {
         field.size = node["size"].as<std::size_t>();
     }
+    if (node["length_field"]) {
+        field.lengthField = node["length_field"].as<std::string>();
+    }
     
     return field;
 }
@@ -97,6 +133,48 @@ ir::IRPacket parseIRPacket(const YAML::Node& node) {
     return packet;
 }
 
+ir::IRHeaderField parseIRHeaderField(const YAML::Node& node, const char* what) {
+    ir::IRHeaderField field;
+    if (!node["offset"]) {
+        throw std::runtime_error(std::string("Frame ") + what + " missing 'offset'");
+    }
+    field.offset = node["offset"].as<std::size_t>();
+    field.type = node["type"] ? node["type"].as<std::string>() : "uint8";
+    return field;
+}
+
+ir::IRFrameHeader parseIRFrameHeader(const YAML::Node& node) {
+    ir::IRFrameHeader frame;
+    
+    if (node["sync"]) {
+        for (const auto& byteNode : node["sync"]) {
+            auto value = byteNode.as<int64_t>();
+            if (value < 0 || value > 0xFF) {
+                throw std::runtime_error("Frame sync value " + std::to_string(value) + " is not a byte (0-255)");
+            }
+            frame.sync.push_back(static_cast<uint8_t>(value));
+        }
+    }
+    
+    if (!node["id"]) {
+        throw std::runtime_error("Frame header missing 'id'");
+    }
+    frame.id = parseIRHeaderField(node["id"], "id");
+    
+    if (node["length"]) {
+        frame.length = parseIRHeaderField(node["length"], "length");
+        if (node["length"]["adjust"]) {
+            frame.lengthAdjust = node["length"]["adjust"].as<int64_t>();
+        }
+    }
+    
+    if (node["size"]) {
+        frame.size = node["size"].as<std::size_t>();
+    }
+    
+    return frame;
+}
+
 } // anonymous namespace
 
 ir::IRSchema YamlSchemaParser::parseToIR(std::string_view content) {
@@ -119,6 +197,9 @@ ir::IRSchema YamlSchemaParser::parseToIR(std::string_view content) {
         if (schemaNode["byte_order"]) {
             ir.info.byteOrder = schemaNode["byte_order"].as<std::string>();
         }
+        if (schemaNode["frame"]) {
+            ir.frame = parseIRFrameHeader(schemaNode["frame"]);
+        }
     }
     
     // Parse packets
@@ -0,0 +1,227 @@
+#include <catch2/catch_test_macros.hpp>
+#include <ionet/core/Arena.h>
+#include <ionet/codec/Decoder.h>
+#include <ionet/schema/SchemaBuilder.h>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+using namespace ionet::codec;
+using namespace ionet::schema;
+using namespace ionet::core;
+
+namespace {
+
+/// Upstream resource that counts what it hands out
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0;
+    std::size_t outstanding = 0;
+    
+    /// True if `ptr` is inside a block this resource handed out
+    bool handedOut(const void* ptr) const {
+        const auto* byte = static_cast<const std::byte*>(ptr);
+        return std::ranges::any_of(blocks_, [&](const auto& block) {
+            return byte >= block.first && byte < block.first + block.second;
+        });
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        ++outstanding;
+        auto* ptr = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        blocks_.emplace_back(static_cast<const std::byte*>(ptr), bytes);
+        return ptr;
+    }
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+        --outstanding;
+        std::erase_if(blocks_, [&](const auto& block) { return block.first == ptr; });
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+    
+    std::vector<std::pair<const std::byte*, std::size_t>> blocks_;
+};
+
+} // anonymous namespace
+
+TEST_CASE("Arena - bump allocation and reset", "[arena]") {
+    CountingResource upstream;
+    Arena arena(1024, &upstream);
+    REQUIRE(arena.chunkCount() == 0);
+
+    auto* a = arena.allocate(10, 1);
+    auto* b = arena.allocate(8, 8);
+    auto* c = arena.allocate(64, 64);
+    REQUIRE(reinterpret_cast<uintptr_t>(b) % 8 == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(c) % 64 == 0);
+    REQUIRE(static_cast<std::byte*>(b) >= static_cast<std::byte*>(a) + 10);
+    REQUIRE(arena.chunkCount() == 1);
+    REQUIRE(arena.bytesUsed() >= 82);
+
+    // Deallocation is a no-op; oversized requests get their own chunk
+    arena.deallocate(a, 10, 1);
+    auto* big = arena.allocate(4000, 16);
+    REQUIRE(big != nullptr);
+    REQUIRE(arena.chunkCount() == 2);
+    REQUIRE(arena.capacity() >= 1024 + 4000);
+
+    // Reset keeps the chunks, so the same pattern needs nothing new upstream
+    arena.reset();
+    REQUIRE(arena.bytesUsed() == 0);
+    REQUIRE(arena.allocate(10, 1) == a);
+    REQUIRE(arena.allocate(8, 8) == b);
+    REQUIRE(arena.allocate(64, 64) == c);
+    REQUIRE(arena.allocate(4000, 16) == big);
+    REQUIRE(upstream.allocations == 2);
+
+    arena.release();
+    REQUIRE(arena.chunkCount() == 0);
+    REQUIRE(arena.capacity() == 0);
+    REQUIRE(upstream.outstanding == 0);
+}
+
+TEST_CASE("Arena - decoded packets share one reset", "[arena]") {
+    auto schema = SchemaBuilder()
+        .name("Arena")
+        .bigEndian()
+        .packet(1, "Status")
+            .uint16("counter")
+            .int16("temperature").scaled(0.5)
+            .bitfield("mode", 8)
+                .subfield(0, 4, "state")
+                .subfield(4, 4, "channel")
+        .build();
+    Decoder decoder(schema);
+    std::vector<uint8_t> frame = {0x00, 0x07, 0xFF, 0xF6, 0x3A};
+
+    CountingResource upstream;
+    Arena arena(4096, &upstream);
+    DecodedPacket kept;
+    std::size_t chunksAfterFirstWindow = 0;
+
+    auto decodeWindow = [&](int window) {
+        std::pmr::vector<DecodedPacket> packets(&arena);
+        for (int i = 0; i < 200; ++i) {
+            auto& packet = packets.emplace_back();
+            REQUIRE(decoder.decodeInto(1, frame, packet) == DecodeStatus::Ok);
+        }
+
+        const auto& packet = packets.back();
+        REQUIRE(packet.get_allocator().resource() == &arena);
+        const auto* mode = packet.field("mode");
+        REQUIRE(mode->bitfield()->subfield("channel") == 3u);
+        REQUIRE(*packet.get<double>("temperature") == -5.0);
+
+        if (window == 0) {
+            // Copies leave the arena
+            kept = packet;
+            REQUIRE(kept.get_allocator().resource() != &arena);
+            chunksAfterFirstWindow = arena.chunkCount();
+        }
+        REQUIRE(arena.chunkCount() == chunksAfterFirstWindow);
+    };
+
+    for (int window = 0; window < 3; ++window) {
+        decodeWindow(window);
+        // Destroying the packets freed nothing; the window goes in one reset
+        arena.reset();
+    }
+
+    REQUIRE(*kept.get<uint64_t>("counter") == 7);
+    REQUIRE(kept.field("mode")->bitfield()->subfield("state") == 0xAu);
+}
+
+TEST_CASE("Arena - payloads follow packet copies and moves", "[arena]") {
+    auto schema = SchemaBuilder()
+        .name("Payloads")
+        .bigEndian()
+        .packet(1, "Mixed")
+            .uint8("count")
+            .string("label", 4)
+            .array("samples", DataType::Int16, 2).scaled(0.5)
+            .string("tail", 2)
+        .build();
+    Decoder decoder(schema);
+    std::vector<uint8_t> frame = {0x02, 'a', 'b', 'c', 'd', 0x00, 0x04, 0xFF, 0xFE, 'x', 'y'};
+
+    auto check = [](const DecodedPacket& packet) {
+        REQUIRE(packet.field("label")->text() == "abcd");
+        REQUIRE(packet.field("tail")->text() == "xy");
+        REQUIRE(std::ranges::equal(packet.field("samples")->scaledArray(), RealArray{2.0, -1.0}));
+        REQUIRE(*packet.get<uint64_t>("count") == 2);
+    };
+
+    CountingResource upstream;
+    Arena arena(4096, &upstream);
+    std::optional<DecodedPacket> original(std::in_place, &arena);
+    REQUIRE(decoder.decodeInto(1, frame, *original) == DecodeStatus::Ok);
+    check(*original);
+    
+    // Owned contents come from the packet's resource, not the global heap
+    auto inArena = [&](const DecodedPacket& packet) {
+        return upstream.handedOut(packet.field("label")->text().data())
+            && upstream.handedOut(packet.field("samples")->elements<int16_t>().data())
+            && upstream.handedOut(packet.field("samples")->scaledArray().data());
+    };
+    REQUIRE(inArena(*original));
+
+    // Copies get their own payload lists; fields must point at them
+    DecodedPacket copied(*original);
+    DecodedPacket assigned;
+    assigned = *original;
+    DecodedPacket moved(DecodedPacket(*original), &arena);
+    DecodedPacket moveAssigned;
+    moveAssigned = DecodedPacket(*original, &arena);
+    original.reset();
+
+    check(copied);
+    check(assigned);
+    check(moved);
+    check(moveAssigned);
+    REQUIRE(moved.get_allocator().resource() == &arena);
+    REQUIRE(moveAssigned.get_allocator().resource() != &arena);
+    REQUIRE(inArena(moved));
+    REQUIRE_FALSE(inArena(copied));
+    REQUIRE_FALSE(inArena(assigned));
+    REQUIRE_FALSE(inArena(moveAssigned));
+}
+
+TEST_CASE("Arena - variable-length refills reuse payloads", "[arena]") {
+    auto schema = SchemaBuilder()
+        .name("Variable")
+        .bigEndian()
+        .packet(1, "Report")
+            .uint8("name_len")
+            .string("name", 32).lengthFrom("name_len")
+            .uint8("count")
+            .array("samples", DataType::Int16, 8).lengthFrom("count").scaled(0.5)
+        .build();
+    Decoder decoder(schema);
+    std::vector<uint8_t> longer = {20};
+    longer.insert(longer.end(), 20, 'n');
+    longer.insert(longer.end(), {3, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06});
+    std::vector<uint8_t> shorter = {3, 'c', 'a', 'm', 1, 0xFF, 0xFE};
+
+    CountingResource upstream;
+    DecodedPacket packet(&upstream);
+    REQUIRE(decoder.decodeInto(1, longer, packet) == DecodeStatus::Ok);
+    const auto allocations = upstream.allocations;
+
+    // Same packet type: contents fit the storage already there
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(decoder.decodeInto(1, i % 2 ? longer : shorter, packet) == DecodeStatus::Ok);
+    }
+    REQUIRE(upstream.allocations == allocations);
+    REQUIRE(packet.field("name")->text() == std::string(20, 'n'));
+    REQUIRE(std::ranges::equal(packet.field("samples")->scaledArray(), RealArray{1.0, 2.0, 3.0}));
+
+    REQUIRE(decoder.decodeInto(1, shorter, packet) == DecodeStatus::Ok);
+    REQUIRE(packet.field("name")->text() == "cam");
+    REQUIRE(std::ranges::equal(packet.field("samples")->elements<int16_t>(), std::vector<int16_t>{-2}));
+    REQUIRE(upstream.allocations == allocations);
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include <ionet/core/BitReader.h>
+#include <vector>
+
+using namespace ionet::core;
+
+namespace {
+
+/// Bit-at-a-time reference reader (MSB-first)
+uint64_t referenceBits(const std::vector<uint8_t>& data, std::size_t pos, unsigned width) {
+    uint64_t value = 0;
+    for (unsigned i = 0; i < width; ++i) {
+        std::size_t bit = pos + i;
+        value = (value << 1) | ((data[bit / 8] >> (7 - bit % 8)) & 1);
+    }
+    return value;
+}
+
+} // anonymous namespace
+
+TEST_CASE("BitReader - 12-bit samples back to back", "[bits]") {
+    // 0xABC, 0x123, 0xFFF, 0x000
+    std::vector<uint8_t> data = {0xAB, 0xC1, 0x23, 0xFF, 0xF0, 0x00};
+    BitReader bits(data);
+
+    REQUIRE(bits.read(12) == 0xABC);
+    REQUIRE(bits.read(12) == 0x123);
+    REQUIRE(bits.position() == 24);
+    REQUIRE(bits.read(12) == 0xFFF);
+    REQUIRE(bits.read(12) == 0x000);
+    REQUIRE(bits.remaining() == 0);
+
+    uint64_t value = 0;
+    REQUIRE_FALSE(bits.tryRead(1, value));
+}
+
+TEST_CASE("BitReader - every width and position matches reference", "[bits]") {
+    std::vector<uint8_t> data(40);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+
+    for (unsigned width = 1; width <= 64; ++width) {
+        BitReader bits(data);
+        std::size_t pos = 0;
+        uint64_t value = 0;
+        while (bits.tryRead(width, value)) {
+            REQUIRE(value == referenceBits(data, pos, width));
+            pos += width;
+            REQUIRE(bits.position() == pos);
+        }
+        REQUIRE(data.size() * 8 - pos < width);
+    }
+
+    for (std::size_t start : {0u, 3u, 7u, 8u, 61u, 250u}) {
+        BitReader bits(data, start);
+        REQUIRE(bits.position() == start);
+        REQUIRE(bits.read(17) == referenceBits(data, start, 17));
+    }
+}
+
+TEST_CASE("BitReader - signed values are sign extended", "[bits]") {
+    std::vector<uint8_t> data = {0xF8, 0x07, 0xFF};     // 0xF80 | 0x7FF
+    BitReader bits(data);
+
+    int64_t value = 0;
+    REQUIRE(bits.tryReadSigned(12, value));
+    REQUIRE(value == -128);
+    REQUIRE(bits.tryReadSigned(12, value));
+    REQUIRE(value == 2047);
+
+    REQUIRE(signExtend(0x1, 1) == -1);
+    REQUIRE(signExtend(0x7FFFFFFFFFFFFFFFull, 64) == INT64_MAX);
+}
+
+TEST_CASE("BitReader - seek and failed reads", "[bits]") {
+    std::vector<uint8_t> data = {0x12, 0x34, 0x56};
+    BitReader bits(data);
+
+    bits.seek(4);
+    REQUIRE(bits.read(8) == 0x23);
+    bits.seek(0);
+    REQUIRE(bits.read(4) == 0x1);
+
+    uint64_t value = 0;
+    REQUIRE_FALSE(bits.tryRead(21, value));
+    REQUIRE(bits.position() == 4);
+    REQUIRE_FALSE(bits.tryRead(0, value));
+    REQUIRE(bits.tryRead(20, value));
+    REQUIRE(value == 0x23456);
+
+    bits.seek(100);
+    REQUIRE(bits.position() == 24);
+    REQUIRE(bits.remaining() == 0);
+}
@@ -25,6 +25,29 @@ TEST_CASE("ByteBufferReader - buffer underflow", "[bytebuffer]") {
     }
 }
 
+TEST_CASE("ByteBufferReader - try reads", "[bytebuffer]") {
+    std::vector<uint8_t> data = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    ByteBufferReader reader(data);
+
+    uint32_t val32 = 0;
+    REQUIRE(reader.tryReadUInt32(val32, ByteOrder::Big));
+    REQUIRE(val32 == 0x01020304);
+
+    // Underflow reports failure and leaves the position alone
+    REQUIRE_FALSE(reader.tryReadUInt32(val32, ByteOrder::Big));
+    REQUIRE(reader.position() == 4);
+    REQUIRE_FALSE(reader.trySkip(3));
+
+    std::span<const uint8_t> rest;
+    REQUIRE(reader.tryReadBytes(2, rest));
+    REQUIRE(rest.size() == 2);
+    REQUIRE(rest[1] == 0x06);
+    REQUIRE(reader.remaining() == 0);
+
+    uint8_t val8 = 0;
+    REQUIRE_FALSE(reader.tryReadUInt8(val8));
+}
+
 TEST_CASE("ByteBufferWriter - write integers", "[bytebuffer]") {
     ByteBufferWriter writer;
 
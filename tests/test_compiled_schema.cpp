@@ -0,0 +1,341 @@
+#include <catch2/catch_test_macros.hpp>
+#include <ionet/codec/CompiledSchema.h>
+#include <ionet/codec/Decoder.h>
+#include <ionet/schema/SchemaBuilder.h>
+#include <vector>
+
+using namespace ionet::codec;
+using namespace ionet::schema;
+using namespace ionet::core;
+
+namespace {
+
+Schema makeFlightSchema() {
+    return SchemaBuilder()
+        .name("RocketTelemetry")
+        .bigEndian()
+        .packet(0x01, "FlightData")
+            .uint64("timestamp")
+            .float32("altitude")
+            .int16("temperature").scaled(0.01, -40.0)
+            .bitfield("engine_status", 8)
+                .flag(0, "engine_1_active")
+        .packet(0x02, "Label")
+            .field("text", DataType::String)
+        .build();
+}
+
+} // anonymous namespace
+
+TEST_CASE("CompiledSchema - precomputed offsets", "[compiled]") {
+    auto schema = makeFlightSchema();
+    CompiledSchema compiled(schema);
+
+    const auto* plan = compiled.find(0x01);
+    REQUIRE(plan != nullptr);
+    REQUIRE(plan->isFixedSize());
+    REQUIRE(plan->size() == 15);
+
+    const auto& fields = plan->fields();
+    REQUIRE(fields.size() == 4);
+    REQUIRE(fields[0].offset == 0);
+    REQUIRE(fields[1].offset == 8);
+    REQUIRE(fields[2].offset == 12);
+    REQUIRE(fields[3].offset == 14);
+    REQUIRE(fields[2].scaled);
+    REQUIRE(fields[2].scale == 0.01);
+    REQUIRE(fields[2].bias == -40.0);
+    REQUIRE(fields[3].width == 1);
+
+    REQUIRE(compiled.find(0x99) == nullptr);
+}
+
+TEST_CASE("CompiledSchema - unsized string is not fixed size", "[compiled]") {
+    auto schema = makeFlightSchema();
+    CompiledSchema compiled(schema);
+
+    const auto* plan = compiled.find(0x02);
+    REQUIRE(plan != nullptr);
+    REQUIRE_FALSE(plan->isFixedSize());
+}
+
+TEST_CASE("CompiledSchema - decoder rejects short frame up front", "[compiled]") {
+    auto schema = makeFlightSchema();
+    Decoder decoder(schema);
+
+    std::vector<uint8_t> data(14, 0x00);
+    auto result = decoder.decode(0x01, data);
+    REQUIRE(result.hasError());
+    REQUIRE(result.error().message.find("needs 15 bytes") != std::string::npos);
+}
+
+TEST_CASE("CompiledSchema - reader advances past decoded frame", "[compiled]") {
+    auto schema = makeFlightSchema();
+    Decoder decoder(schema);
+
+    ByteBufferWriter writer;
+    for (uint64_t ts : {100u, 200u}) {
+        writer.writeUInt64(ts, ByteOrder::Big);
+        writer.writeFloat32(1.5f, ByteOrder::Big);
+        writer.writeInt16(6500, ByteOrder::Big);
+        writer.writeUInt8(0x01);
+    }
+
+    ByteBufferReader reader(writer.data());
+
+    auto first = decoder.decode(0x01, reader);
+    REQUIRE(first.ok());
+    REQUIRE(reader.position() == 15);
+    REQUIRE(*first.value().get<uint64_t>("timestamp") == 100);
+
+    auto second = decoder.decode(0x01, reader);
+    REQUIRE(second.ok());
+    REQUIRE(reader.atEnd());
+    REQUIRE(*second.value().get<uint64_t>("timestamp") == 200);
+    REQUIRE(*second.value().get<double>("temperature") == (6500 * 0.01) - 40.0);
+    REQUIRE(second.value().field("engine_status")->bitfield()->isSet("engine_1_active"));
+}
+
+TEST_CASE("CompiledSchema - bit-packed fields", "[compiled][bits]") {
+    // 3-bit version, 12-bit ADC x2 (second signed), 1-bit flag, then a byte-aligned uint16
+    auto schema = SchemaBuilder()
+        .name("Packed")
+        .bigEndian()
+        .packet(0x10, "Adc")
+            .uint8("version").bits(3)
+            .uint16("adc0").bits(12)
+            .int16("adc1").bits(12).scaled(0.5)
+            .uint8("valid").bits(1)
+            .uint16("crc")
+            .uint8("spare").bits(4, 4)
+        .build();
+    CompiledSchema compiled(schema);
+    
+    const auto* plan = compiled.find(0x10);
+    REQUIRE(plan->isFixedSize());
+    REQUIRE(plan->size() == 6);
+    REQUIRE(plan->fields()[1].bitOffset == 3);
+    REQUIRE(plan->fields()[1].offset == 0);
+    REQUIRE(plan->fields()[1].width == 2);
+    REQUIRE(plan->fields()[4].offset == 4);
+    REQUIRE(plan->fields()[5].offset == 0);
+    
+    // 101 | 1010 1011 1100 | 1111 1111 1110 | 1 | pad | crc 0xBEEF
+    std::vector<uint8_t> frame = {0xB5, 0x79, 0xFF, 0xD0, 0xBE, 0xEF};
+    Decoder decoder(schema);
+    
+    DecodedPacket packet;
+    REQUIRE(decoder.decodeInto(0x10, frame, packet) == DecodeStatus::Ok);
+    REQUIRE(*packet.get<uint64_t>("version") == 5);
+    REQUIRE(*packet.get<uint64_t>("adc0") == 0xABC);
+    REQUIRE(std::get<int64_t>(packet.field("adc1")->rawValue()) == -2);
+    REQUIRE(*packet.get<double>("adc1") == -1.0);
+    REQUIRE(*packet.get<uint64_t>("valid") == 1);
+    REQUIRE(*packet.get<uint64_t>("crc") == 0xBEEF);
+    REQUIRE(*packet.get<uint64_t>("spare") == 0x5);
+    
+    // Field-by-field reads, views and batches agree
+    DecodeOptions collect;
+    collect.stopOnError = false;
+    Decoder generic(schema, collect);
+    std::vector<uint8_t> shortFrame(frame.begin(), frame.end() - 1);
+    auto partial = generic.decode(0x10, shortFrame);
+    REQUIRE(partial.ok());
+    REQUIRE(*partial.value().get<uint64_t>("adc0") == 0xABC);
+    REQUIRE(*partial.value().get<uint64_t>("valid") == 1);
+    REQUIRE_FALSE(partial.value().hasField("crc"));
+    REQUIRE(*partial.value().get<uint64_t>("spare") == 0x5);
+    
+    auto view = decoder.view(0x10, frame);
+    REQUIRE(view.ok());
+    REQUIRE(std::get<uint64_t>(view.value().raw("adc0")) == 0xABC);
+    REQUIRE(std::get<int64_t>(view.value().raw("adc1")) == -2);
+    
+    auto batch = decoder.decodeBatch(0x10, frame, frame.size());
+    REQUIRE(batch.ok());
+    REQUIRE(*batch.value().column("adc1")->number(0) == -1.0);
+}
+
+TEST_CASE("CompiledSchema - numeric arrays decode in bulk", "[compiled][arrays]") {
+    auto schema = SchemaBuilder()
+        .name("Vibration")
+        .bigEndian()
+        .packet(0x20, "Samples")
+            .uint16("count")
+            .array("accel", DataType::Int16, 64).scaled(0.5, 1.0)
+            .array("temps", DataType::Float32, 3)
+            .uint8("tail")
+        .build();
+    CompiledSchema compiled(schema);
+    
+    const auto* plan = compiled.find(0x20);
+    REQUIRE(plan->isFixedSize());
+    REQUIRE(plan->size() == 2 + 128 + 12 + 1);
+    REQUIRE(plan->fields()[1].count == 64);
+    REQUIRE(plan->fields()[3].offset == 142);
+    
+    ByteBufferWriter writer;
+    writer.writeUInt16(64, ByteOrder::Big);
+    for (int i = 0; i < 64; ++i) {
+        writer.writeInt16(static_cast<int16_t>(i * 100 - 3000), ByteOrder::Big);
+    }
+    for (float t : {20.5f, -3.25f, 100.0f}) {
+        writer.writeFloat32(t, ByteOrder::Big);
+    }
+    writer.writeUInt8(0x7E);
+    const auto& frame = writer.data();
+    
+    Decoder decoder(schema);
+    DecodedPacket packet;
+    REQUIRE(decoder.decodeInto(0x20, frame, packet) == DecodeStatus::Ok);
+    
+    const auto* accel = packet.field("accel");
+    // Elements stay 16-bit; rawValue() widens a copy
+    auto raw = accel->elements<int16_t>();
+    auto scaled = std::get<RealArray>(accel->scaledValue());
+    REQUIRE(accel->elements<int64_t>().empty());
+    REQUIRE(std::get<IntArray>(accel->rawValue()) == IntArray(raw.begin(), raw.end()));
+    REQUIRE(raw.size() == 64);
+    REQUIRE(scaled.size() == 64);
+    for (int i = 0; i < 64; ++i) {
+        REQUIRE(raw[i] == i * 100 - 3000);
+        REQUIRE(scaled[i] == (raw[i] * 0.5) + 1.0);
+    }
+    REQUIRE(*packet.get<RealArray>("temps") == RealArray{20.5, -3.25, 100.0});
+    REQUIRE(*packet.get<uint64_t>("tail") == 0x7E);
+    
+    // Refilling keeps the element storage
+    const auto* storage = raw.data();
+    REQUIRE(decoder.decodeInto(0x20, frame, packet) == DecodeStatus::Ok);
+    REQUIRE(packet.field("accel")->elements<int16_t>().data() == storage);
+    
+    // The field-by-field path reads the same values
+    DecodeOptions collect;
+    collect.stopOnError = false;
+    Decoder generic(schema, collect);
+    std::vector<uint8_t> shortFrame(frame.begin(), frame.end() - 1);
+    auto partial = generic.decode(0x20, shortFrame);
+    REQUIRE(partial.ok());
+    REQUIRE(partial.value().field("accel")->scaledValue() == accel->scaledValue());
+    REQUIRE(partial.value().field("temps")->rawValue() == packet.field("temps")->rawValue());
+    REQUIRE_FALSE(partial.value().hasField("tail"));
+    
+    // Batches keep each row's elements together
+    std::vector<uint8_t> two(frame.begin(), frame.end());
+    two.insert(two.end(), frame.begin(), frame.end());
+    auto batch = decoder.decodeBatch(0x20, two, frame.size());
+    REQUIRE(batch.ok());
+    const auto* column = batch.value().column("accel");
+    REQUIRE(column->count == 64);
+    REQUIRE(column->scaled.size() == 128);
+    REQUIRE(*column->number(1, 63) == scaled[63]);
+    REQUIRE(*batch.value().column("tail")->number(1) == 0x7E);
+}
+
+TEST_CASE("PacketDispatch - dense IDs use a direct array", "[compiled][dispatch]") {
+    std::vector<uint32_t> ids = {0x12, 0x10, 0x11, 0x15};
+    PacketDispatch dispatch(ids);
+
+    REQUIRE(dispatch.kind() == PacketDispatch::Kind::Dense);
+    REQUIRE(dispatch.tableSize() == 6);
+    for (uint32_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(dispatch.find(ids[i]) == i);
+    }
+    REQUIRE(dispatch.find(0x13) == PacketDispatch::kNotFound);
+    REQUIRE(dispatch.find(0x0F) == PacketDispatch::kNotFound);
+    REQUIRE(dispatch.find(0x16) == PacketDispatch::kNotFound);
+    REQUIRE(dispatch.find(0xFFFFFFFF) == PacketDispatch::kNotFound);
+}
+
+TEST_CASE("PacketDispatch - sparse IDs use a perfect hash", "[compiled][dispatch]") {
+    std::vector<uint32_t> ids = {7, 0x100, 0xABCD1234, 0, 0xFFFFFFFF, 0x80000000};
+    PacketDispatch dispatch(ids);
+
+    REQUIRE(dispatch.kind() == PacketDispatch::Kind::PerfectHash);
+    for (uint32_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(dispatch.find(ids[i]) == i);
+    }
+    for (uint32_t id : {1u, 8u, 0x101u, 0xABCD1235u, 0x7FFFFFFFu}) {
+        REQUIRE(dispatch.find(id) == PacketDispatch::kNotFound);
+    }
+}
+
+TEST_CASE("PacketDispatch - large sparse sets stay exact", "[compiled][dispatch]") {
+    std::vector<uint32_t> ids;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        ids.push_back(i * 0x10001u + 3);
+    }
+    PacketDispatch dispatch(ids);
+
+    REQUIRE(dispatch.kind() != PacketDispatch::Kind::Dense);
+    for (uint32_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(dispatch.find(ids[i]) == i);
+        REQUIRE(dispatch.find(ids[i] + 1) == PacketDispatch::kNotFound);
+    }
+}
+
+TEST_CASE("PacketDispatch - repeated IDs map to their last index", "[compiled][dispatch]") {
+    SECTION("Dense") {
+        std::vector<uint32_t> ids = {1, 2, 1, 3};
+        PacketDispatch dispatch(ids);
+        REQUIRE(dispatch.kind() == PacketDispatch::Kind::Dense);
+        REQUIRE(dispatch.find(1) == 2);
+        REQUIRE(dispatch.find(3) == 3);
+    }
+    SECTION("Perfect hash") {
+        std::vector<uint32_t> ids = {7, 0xABCD1234, 0x100, 7};
+        PacketDispatch dispatch(ids);
+        REQUIRE(dispatch.kind() == PacketDispatch::Kind::PerfectHash);
+        REQUIRE(dispatch.find(7) == 3);
+        REQUIRE(dispatch.find(0x100) == 2);
+    }
+    SECTION("Sorted") {
+        std::vector<uint32_t> ids;
+        for (uint32_t i = 0; i < 3000; ++i) {
+            ids.push_back(i * 0x10001u + 3);
+        }
+        ids.push_back(3);
+        PacketDispatch dispatch(ids);
+        REQUIRE(dispatch.kind() == PacketDispatch::Kind::Sorted);
+        REQUIRE(dispatch.find(3) == 3000);
+        REQUIRE(dispatch.find(0x10001u + 3) == 1);
+    }
+}
+
+TEST_CASE("CompiledSchema - duplicated ID resolves as the schema does", "[compiled][dispatch]") {
+    auto schema = SchemaBuilder()
+        .name("Duplicate")
+        .packet(0xABCD1234, "A").uint8("a")
+        .packet(7, "First").uint8("b")
+        .packet(7, "Second").uint16("b")
+        .build();
+    REQUIRE_FALSE(schema.validate());
+    
+    CompiledSchema compiled(schema);
+    REQUIRE(compiled.packets().size() == 3);
+    REQUIRE(&compiled.find(7)->packet() == schema.findPacketById(7));
+    REQUIRE(compiled.find(7)->packet().name == "Second");
+    REQUIRE(compiled.find(0xABCD1234)->packet().name == "A");
+}
+
+TEST_CASE("PacketDispatch - empty set finds nothing", "[compiled][dispatch]") {
+    PacketDispatch dispatch;
+    REQUIRE(dispatch.kind() == PacketDispatch::Kind::Empty);
+    REQUIRE(dispatch.find(0) == PacketDispatch::kNotFound);
+}
+
+TEST_CASE("CompiledSchema - find resolves sparse packet IDs", "[compiled][dispatch]") {
+    auto schema = SchemaBuilder()
+        .name("Sparse")
+        .packet(0xABCD1234, "A").uint8("a")
+        .packet(7, "B").uint16("b")
+        .packet(0x100, "C").uint32("c")
+        .build();
+    CompiledSchema compiled(schema);
+
+    REQUIRE(compiled.dispatch().kind() == PacketDispatch::Kind::PerfectHash);
+    REQUIRE(compiled.find(0xABCD1234)->packet().name == "A");
+    REQUIRE(compiled.find(7)->packet().name == "B");
+    REQUIRE(compiled.find(0x100)->size() == 4);
+    REQUIRE(compiled.find(8) == nullptr);
+}
@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include <ionet/codec/DecodePipeline.h>
+#include <ionet/core/Endian.h>
+#include <ionet/schema/SchemaBuilder.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace ionet::codec;
+using namespace ionet::schema;
+using namespace ionet::core;
+
+namespace {
+
+Schema pipelineSchema() {
+    SchemaBuilder builder;
+    for (uint32_t id = 1; id <= 5; ++id) {
+        builder.packet(id, "P" + std::to_string(id)).uint32("seq");
+    }
+    return builder.build();
+}
+
+std::vector<uint8_t> seqFrame(uint32_t seq) {
+    std::vector<uint8_t> frame(4);
+    endian::store(seq, frame.data(), ByteOrder::Big);
+    return frame;
+}
+
+} // anonymous namespace
+
+TEST_CASE("DecodePipeline - keeps per-packet order", "[pipeline]") {
+    auto schema = pipelineSchema();
+    Decoder decoder(schema);
+
+    std::mutex mutex;
+    std::map<uint32_t, std::vector<uint32_t>> received;
+
+    PipelineOptions options;
+    options.workers = 3;
+    options.queueCapacity = 8;  // Small queues exercise backpressure
+    DecodePipeline pipeline(decoder, [&](const DecodedPacket& packet) {
+        std::lock_guard<std::mutex> lock(mutex);
+        received[packet.id()].push_back(static_cast<uint32_t>(*packet.get<uint64_t>("seq")));
+    }, options);
+    REQUIRE(pipeline.workerCount() == 3);
+
+    constexpr uint32_t perId = 2000;
+    for (uint32_t seq = 0; seq < perId; ++seq) {
+        auto frame = seqFrame(seq);
+        for (uint32_t id = 1; id <= 5; ++id) {
+            REQUIRE(pipeline.submit(id, frame));
+        }
+    }
+    pipeline.flush();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    REQUIRE(received.size() == 5);
+    for (const auto& [id, seqs] : received) {
+        REQUIRE(seqs.size() == perId);
+        for (uint32_t i = 0; i < perId; ++i) {
+            REQUIRE(seqs[i] == i);
+        }
+    }
+
+    auto stats = pipeline.stats();
+    REQUIRE(stats.submitted == 5 * perId);
+    REQUIRE(stats.decoded == 5 * perId);
+    REQUIRE(stats.failed == 0);
+}
+
+TEST_CASE("DecodePipeline - reports failures and stops", "[pipeline]") {
+    auto schema = pipelineSchema();
+    Decoder decoder(schema);
+
+    std::atomic<int> errors{0};
+    PipelineOptions options;
+    options.workers = 2;
+    DecodePipeline pipeline(decoder, nullptr, options);
+    pipeline.setErrorCallback([&](const DecodeError& error) {
+        if (error.code == DecodeStatus::Truncated) {
+            ++errors;
+        }
+    });
+
+    std::vector<uint8_t> shortFrame = {0x01};
+    REQUIRE(pipeline.submit(1, shortFrame));
+    REQUIRE(pipeline.trySubmit(2, seqFrame(7)));
+    pipeline.stop();
+
+    REQUIRE(errors == 1);
+    REQUIRE(pipeline.stats().failed == 1);
+    REQUIRE(pipeline.stats().decoded == 1);
+    REQUIRE_FALSE(pipeline.submit(1, seqFrame(1)));
+}
+
+TEST_CASE("DecodePipeline - frames pass through the slab", "[pipeline]") {
+    auto schema = pipelineSchema();
+    Decoder decoder(schema);
+
+    std::mutex mutex;
+    std::vector<uint32_t> received;
+
+    // Room for a few frames per worker: the lanes wrap and fill constantly
+    PipelineOptions options;
+    options.workers = 2;
+    options.laneBytes = 18;
+    DecodePipeline pipeline(decoder, [&](const DecodedPacket& packet) {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(static_cast<uint32_t>(*packet.get<uint64_t>("seq")));
+    }, options);
+
+    constexpr uint32_t frames = 5000;
+    for (uint32_t seq = 0; seq < frames; ++seq) {
+        REQUIRE(pipeline.submit(1, seqFrame(seq)));
+    }
+    pipeline.flush();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    REQUIRE(received.size() == frames);
+    for (uint32_t i = 0; i < frames; ++i) {
+        REQUIRE(received[i] == i);
+    }
+
+    // A frame that can never fit is refused rather than waited on
+    std::vector<uint8_t> huge(19);
+    REQUIRE_FALSE(pipeline.submit(1, huge));
+    REQUIRE(pipeline.stats().submitted == frames);
+}
+
+TEST_CASE("DecodePipeline - stats read while frames fail", "[pipeline]") {
+    auto schema = pipelineSchema();
+    Decoder decoder(schema);
+
+    PipelineOptions options;
+    options.workers = 1;
+    DecodePipeline pipeline(decoder, nullptr, options);
+
+    // Every frame fails, so nothing may ever count as decoded
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> maxDecoded{0};
+    std::thread reader([&] {
+        while (!done.load()) {
+            maxDecoded = std::max(maxDecoded.load(), pipeline.stats().decoded);
+        }
+    });
+
+    std::vector<uint8_t> shortFrame = {0x01};
+    for (int i = 0; i < 20000; ++i) {
+        REQUIRE(pipeline.submit(1, shortFrame));
+    }
+    pipeline.flush();
+    done = true;
+    reader.join();
+
+    REQUIRE(maxDecoded == 0);
+    REQUIRE(pipeline.stats().failed == 20000);
+}
@@ -2,6 +2,12 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <../include/ionet/codec/Decoder.h>
 #include <../include/ionet/schema/SchemaLoader.h>
+#include <../include/ionet/codec/PacketPool.h>
+#include <../include/ionet/schema/SchemaBuilder.h>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
 
 using namespace ionet::codec;
 using namespace ionet::schema;
@@ -147,7 +153,7 @@ TEST_CASE_METHOD(DecoderFixture, "Decoder - decode with scaling", "[decoder]") {
     // Check unit
     auto* tempField = packet.field("temperature");
     REQUIRE(tempField != nullptr);
-    REQUIRE(tempField->unit == "celsius");
+    REQUIRE(tempField->unit() == "celsius");
 }
 
 TEST_CASE_METHOD(DecoderFixture, "Decoder - decode without scaling", "[decoder]") {
@@ -169,6 +175,131 @@ TEST_CASE_METHOD(DecoderFixture, "Decoder - decode without scaling", "[decoder]"
     auto temp = packet.get<int64_t>("temperature");
     REQUIRE(temp.has_value());
     REQUIRE(*temp == 6500);
+    REQUIRE_FALSE(packet.field("temperature")->hasScaling());
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - raw constraint limits", "[decoder]") {
+    DecodeOptions opts;
+    opts.applyScaling = false;
+    opts.rawConstraints = true;
+    Decoder decoder(*schema_, opts);
+    
+    // temperature = 6500 is 25 C, but 6500 as a raw count is above max 85
+    std::vector<uint8_t> data = {0x19, 0x64, 0x0C, 0xE4};
+    auto result = decoder.decode(2, data);
+    REQUIRE(result.hasError());
+    REQUIRE(result.error().message.find("above maximum") != std::string::npos);
+    REQUIRE(decoder.decodeBatch(2, data, 4).hasError());
+    
+    // Ignored while scaling is on
+    opts.applyScaling = true;
+    decoder.setOptions(opts);
+    REQUIRE(decoder.decode(2, data).ok());
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - compact fields refer to the schema", "[decoder]") {
+    static_assert(sizeof(Scalar) == 16);
+    static_assert(sizeof(DecodedField) <= 32);
+
+    Decoder decoder(*schema_);
+    std::vector<uint8_t> data = {0x19, 0x64, 0x0C, 0xE4};
+    DecodedPacket packet;
+    REQUIRE(decoder.decodeInto(2, data, packet) == DecodeStatus::Ok);
+
+    // Names and units are the schema's own strings
+    const auto* def = schema_->findPacketById(2)->findField("temperature");
+    const auto* temp = packet.field("temperature");
+    REQUIRE(temp->def == def);
+    REQUIRE(temp->name().data() == def->name.data());
+    REQUIRE(temp->unit().data() == def->unit->data());
+
+    // Only the raw number is stored; scaling is applied on access
+    REQUIRE(temp->scalar() == Scalar(int64_t{6500}));
+    REQUIRE(temp->elements<int16_t>().empty());
+    REQUIRE(temp->hasScaling());
+    REQUIRE(std::get<int64_t>(temp->rawValue()) == 6500);
+    REQUIRE_THAT(std::get<double>(temp->scaledValue()), Catch::Matchers::WithinAbs(25.0, 0.001));
+    REQUIRE(temp->value() == temp->scaledValue());
+
+    // The field-by-field path builds the same fields
+    DecodeOptions collect;
+    collect.stopOnError = false;
+    Decoder generic(*schema_, collect);
+    auto partial = generic.decode(2, std::vector<uint8_t>(data.begin(), data.end() - 1));
+    REQUIRE(partial.ok());
+    REQUIRE(partial.value().field("temperature")->scalar() == temp->scalar());
+    REQUIRE(partial.value().field("temperature")->def == def);
+    REQUIRE_FALSE(partial.value().hasField("voltage"));
+}
+
+TEST_CASE("Decoder - scaling is flagged per field and runs on access", "[decoder]") {
+    auto schema = SchemaBuilder()
+        .name("Lazy")
+        .bigEndian()
+        .packet(1, "Mixed")
+            .float32("gain").scaled(2.0, 1.0)
+            .float32("ratio")
+            .array("samples", DataType::Int16, 3).scaled(0.5)
+        .build();
+    ByteBufferWriter writer;
+    writer.writeFloat32(1.5f, ByteOrder::Big);
+    writer.writeFloat32(0.25f, ByteOrder::Big);
+    for (int16_t sample : {2, -4, 6}) {
+        writer.writeInt16(sample, ByteOrder::Big);
+    }
+    const auto& frame = writer.data();
+
+    Decoder decoder(schema);
+    DecodedPacket packet;
+    REQUIRE(decoder.decodeInto(1, frame, packet) == DecodeStatus::Ok);
+
+    // Raw doubles are still flagged as scaled
+    const auto* gain = packet.field("gain");
+    REQUIRE(gain->hasScaling());
+    REQUIRE(gain->scalar() == Scalar(1.5));
+    REQUIRE(*gain->as<double>() == 4.0);
+    REQUIRE_FALSE(packet.field("ratio")->hasScaling());
+    REQUIRE(*packet.field("ratio")->as<double>() == 0.25);
+
+    // Arrays are scaled as they are decoded; reads only look
+    const auto* samples = packet.field("samples");
+    const auto scaled = samples->scaledArray();
+    REQUIRE(std::ranges::equal(scaled, RealArray{1.0, -2.0, 3.0}));
+    REQUIRE(samples->scaledArray().data() == scaled.data());
+    REQUIRE(*samples->as<RealArray>() == RealArray{1.0, -2.0, 3.0});
+    REQUIRE(packet.field("ratio")->scaledArray().empty());
+
+    // A refill rescales the new raw elements into the same storage
+    auto next = frame;
+    next[13] = 8;
+    const auto* storage = scaled.data();
+    REQUIRE(decoder.decodeInto(1, next, packet) == DecodeStatus::Ok);
+    REQUIRE(std::ranges::equal(packet.field("samples")->scaledArray(), RealArray{1.0, -2.0, 4.0}));
+    REQUIRE(packet.field("samples")->scaledArray().data() == storage);
+    
+    // So const reads from several threads share the packet safely
+    std::vector<std::thread> readers;
+    std::atomic<int> matches{0};
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            const auto& shared = packet;
+            if (*shared.field("samples")->as<RealArray>() == RealArray{1.0, -2.0, 4.0}) {
+                ++matches;
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    REQUIRE(matches == 4);
+
+    DecodeOptions raw;
+    raw.applyScaling = false;
+    Decoder unscaled(schema, raw);
+    REQUIRE(unscaled.decodeInto(1, frame, packet) == DecodeStatus::Ok);
+    REQUIRE_FALSE(packet.field("gain")->hasScaling());
+    REQUIRE(*packet.field("gain")->as<double>() == 1.5);
+    REQUIRE(packet.field("samples")->scaledArray().empty());
 }
 
 TEST_CASE_METHOD(DecoderFixture, "Decoder - decode bitfield", "[decoder]") {
@@ -188,9 +319,9 @@ TEST_CASE_METHOD(DecoderFixture, "Decoder - decode bitfield", "[decoder]") {
     
     auto* statusField = packet.field("status");
     REQUIRE(statusField != nullptr);
-    REQUIRE(statusField->bitfield.has_value());
+    REQUIRE(statusField->bitfield().has_value());
     
-    auto& bf = *statusField->bitfield;
+    auto bf = *statusField->bitfield();
     REQUIRE(bf.rawValue == 0x83);
     REQUIRE(bf.isSet("active") == true);
     REQUIRE(bf.isSet("error") == true);
@@ -202,6 +333,72 @@ TEST_CASE_METHOD(DecoderFixture, "Decoder - decode bitfield", "[decoder]") {
     REQUIRE(*mode == 5);
 }
 
+TEST_CASE_METHOD(DecoderFixture, "Decoder - bitfield flags by mask", "[decoder]") {
+    Decoder decoder(*schema_);
+    const auto* statusDef = schema_->findPacketById(3)->findField("status");
+    
+    auto active = statusDef->flagMask("active");
+    auto error = statusDef->flagMask("error");
+    auto ready = statusDef->flagMask("ready");
+    REQUIRE(active == 0x01u);
+    REQUIRE(error == 0x02u);
+    REQUIRE(ready == 0x80u);
+    REQUIRE_FALSE(statusDef->flagMask("missing").has_value());
+    
+    std::vector<uint8_t> data = {0x81, 0x00};
+    auto result = decoder.decode(3, data);
+    REQUIRE(result.ok());
+    
+    auto bf = *result.value().field("status")->bitfield();
+    REQUIRE(bf.def == statusDef);
+    REQUIRE(bf.any(*active));
+    REQUIRE_FALSE(bf.any(*error));
+    REQUIRE(bf.all(*active | *ready));
+    REQUIRE_FALSE(bf.all(*active | *error));
+    REQUIRE(bf.any(*active | *error));
+    REQUIRE_FALSE(bf.isSet("missing"));
+    REQUIRE_FALSE(DecodedBitfield{0xFF}.isSet("active"));
+}
+
+TEST_CASE("Decoder - bitfield subfields", "[decoder]") {
+    auto schema = SchemaBuilder()
+        .name("Subfields")
+        .bigEndian()
+        .packet(1, "Status")
+            .bitfield("status", 16)
+                .flag(0, "armed")
+                .subfield(1, 3, "mode")
+                    .label(0, "safe")
+                    .label(5, "burn")
+                .subfield(8, 4, "gain").subfieldScaled(0.5, 1.0)
+                .subfield(12, 4, "counter")
+        .build();
+    Decoder decoder(schema);
+    
+    // counter=0xA, gain=6, mode=5, armed
+    std::vector<uint8_t> data = {0xA6, 0x0B};
+    DecodedPacket packet;
+    REQUIRE(decoder.decodeInto(1, data, packet) == DecodeStatus::Ok);
+    
+    auto bf = *packet.field("status")->bitfield();
+    REQUIRE(bf.isSet("armed"));
+    std::vector<uint64_t> values(4);
+    REQUIRE(bf.extractSubfields(values) == 3);
+    values.resize(3);
+    REQUIRE(values == std::vector<uint64_t>{5, 6, 0xA});
+    REQUIRE(bf.subfield("mode") == 5u);
+    REQUIRE(*bf.subfieldLabel("mode") == "burn");
+    REQUIRE(bf.subfieldLabel("gain") == nullptr);
+    REQUIRE(bf.scaledSubfield("gain") == 4.0);
+    REQUIRE(bf.scaledSubfield("counter") == 10.0);
+    REQUIRE_FALSE(bf.subfield("missing").has_value());
+    
+    // The generic path extracts the same values
+    auto result = decoder.decode(1, data);
+    REQUIRE(result.ok());
+    REQUIRE(result.value().field("status")->bitfield()->subfield("counter") == 0xAu);
+}
+
 TEST_CASE_METHOD(DecoderFixture, "Decoder - decode all types", "[decoder]") {
     Decoder decoder(*schema_);
     
@@ -251,9 +448,9 @@ TEST_CASE_METHOD(DecoderFixture, "Decoder - decode string", "[decoder]") {
     
     auto* labelField = packet.field("label");
     REQUIRE(labelField != nullptr);
-    REQUIRE(std::holds_alternative<std::string>(labelField->rawValue));
+    REQUIRE(std::holds_alternative<std::string>(labelField->rawValue()));
     
-    auto label = std::get<std::string>(labelField->rawValue);
+    auto label = std::get<std::string>(labelField->rawValue());
     REQUIRE(label.substr(0, 5) == "HELLO");
     
     REQUIRE(*packet.get<uint64_t>("id") == 42);
@@ -349,7 +546,7 @@ TEST_CASE_METHOD(DecoderFixture, "Decoder - field iteration", "[decoder]") {
     
     std::vector<std::string> fieldNames;
     for (const auto& field : packet) {
-        fieldNames.push_back(field.name);
+        fieldNames.emplace_back(field.name());
     }
     
     REQUIRE(fieldNames.size() == 2);
@@ -373,4 +570,730 @@ TEST_CASE_METHOD(DecoderFixture, "Decoder - hasField check", "[decoder]") {
     REQUIRE(packet.hasField("counter") == true);
     REQUIRE(packet.hasField("value") == true);
     REQUIRE(packet.hasField("nonexistent") == false);
+    
+    // Names are looked up in the schema's interned index
+    REQUIRE(packet.name().data() == schema_->packetNames(1)->packet.data());
+    REQUIRE(packet.field(std::string_view("value")) == packet.fieldAt(1));
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - lazy view decodes on access", "[decoder]") {
+    Decoder decoder(*schema_);
+    
+    std::vector<uint8_t> data = {
+        0x19, 0x64,  // temperature = 6500
+        0x0C, 0xE4   // voltage = 3300
+    };
+    
+    auto result = decoder.view(2, data);
+    REQUIRE(result.ok());
+    
+    const auto& view = result.value();
+    REQUIRE(view.id() == 2);
+    REQUIRE(view.name() == "ScaledPacket");
+    REQUIRE(view.fieldCount() == 2);
+    REQUIRE(view.data().data() == data.data());
+    
+    REQUIRE_THAT(*view.get<double>("temperature"), Catch::Matchers::WithinAbs(25.0, 0.001));
+    REQUIRE(std::get<int64_t>(view.raw("temperature")) == 6500);
+    REQUIRE_THAT(*view.getAt<double>(1), Catch::Matchers::WithinAbs(3.3, 0.001));
+    REQUIRE_FALSE(view.get<double>("missing").has_value());
+    REQUIRE(view.hasField("voltage"));
+    REQUIRE(std::get<uint64_t>(view.raw(std::string_view("voltage"))) == 3300);
+
+    // Without the schema's names, lookups search the plans
+    CompiledPacket plan(*schema_->findPacketById(2), schema_->byteOrder());
+    DecodedPacketView unnamed(plan, data);
+    REQUIRE(std::get<uint64_t>(unnamed.raw("voltage")) == 3300);
+    REQUIRE_FALSE(unnamed.hasField("missing"));
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - view rejects short frame", "[decoder]") {
+    Decoder decoder(*schema_);
+    
+    std::vector<uint8_t> data = {0x19, 0x64, 0x0C};
+    
+    auto result = decoder.view(2, data);
+    REQUIRE(result.hasError());
+    REQUIRE(decoder.view(999, data).hasError());
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - batch decode into columns", "[decoder]") {
+    Decoder decoder(*schema_);
+    
+    std::vector<std::vector<uint8_t>> frames = {
+        {0x19, 0x64, 0x0C, 0xE4},  // 25.0 C, 3.3 V
+        {0x1F, 0x40, 0x00, 0x00},  // 8000 -> 40.0 C, 0 V
+        {0x19, 0x64},              // short frame
+    };
+    std::vector<std::span<const uint8_t>> spans(frames.begin(), frames.end());
+    
+    DecodeOptions opts;
+    opts.stopOnError = false;
+    opts.fixedPointScaling = true;
+    decoder.setOptions(opts);
+    
+    auto result = decoder.decodeBatch(2, spans);
+    REQUIRE(result.ok());
+    
+    auto& batch = result.value();
+    REQUIRE(batch.rowCount() == 3);
+    REQUIRE(batch.columnCount() == 2);
+    REQUIRE(batch.invalidCount() == 1);
+    REQUIRE_FALSE(batch.isValid(2));
+    
+    const auto* temp = batch.column("temperature");
+    REQUIRE(temp != nullptr);
+    REQUIRE(temp->ints.size() == 3);
+    REQUIRE(temp->ints[0] == 6500);
+    REQUIRE(temp->ints[1] == 8000);
+    REQUIRE(temp->isScaled);
+    REQUIRE_THAT(temp->scaled[0], Catch::Matchers::WithinAbs(25.0, 0.001));
+    REQUIRE_THAT(*temp->number(1), Catch::Matchers::WithinAbs(40.0, 0.001));
+    
+    // The short row holds zeros after scaling too, not the -40 offset
+    REQUIRE(temp->ints[2] == 0);
+    REQUIRE(temp->scaled[2] == 0.0);
+    REQUIRE(temp->isFixed);
+    REQUIRE(temp->fixed[0] == 2500);
+    REQUIRE(temp->fixed[2] == 0);
+    
+    // Short frames are rejected outright when stopping on error
+    decoder.setOptions(DecodeOptions{});
+    REQUIRE(decoder.decodeBatch(2, spans).hasError());
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - batch decode strided buffer", "[decoder]") {
+    Decoder decoder(*schema_);
+    
+    std::vector<uint8_t> data = {
+        0x83, 0x05,
+        0x01, 0x06,
+        0x80, 0x07,
+    };
+    
+    auto result = decoder.decodeBatch(3, data, 2);
+    REQUIRE(result.ok());
+    
+    auto& batch = result.value();
+    REQUIRE(batch.rowCount() == 3);
+    
+    const auto* status = batch.column("status");
+    REQUIRE(status->uints == std::vector<uint64_t>{0x83, 0x01, 0x80});
+    
+    const auto* mode = batch.column("mode");
+    REQUIRE(mode->uints == std::vector<uint64_t>{5, 6, 7});
+    REQUIRE_FALSE(mode->isScaled);
+    
+    REQUIRE(decoder.decodeBatch(3, data, 1).hasError());
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - batch constraint check", "[decoder]") {
+    Decoder decoder(*schema_);
+    
+    std::vector<uint8_t> data = {
+        0x19, 0x64, 0x00, 0x00,  // 25.0 C
+        0x4E, 0x20, 0x00, 0x00,  // 160.0 C, above max
+    };
+    
+    auto result = decoder.decodeBatch(2, data, 4);
+    REQUIRE(result.hasError());
+    REQUIRE(result.error().message.find("above maximum") != std::string::npos);
+    
+    DecodeOptions opts;
+    opts.stopOnError = false;
+    decoder.setOptions(opts);
+    
+    auto collected = decoder.decodeBatch(2, data, 4);
+    REQUIRE(collected.ok());
+    REQUIRE(collected.value().isValid(0));
+    REQUIRE_FALSE(collected.value().isValid(1));
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - fixed-point scaling", "[decoder]") {
+    std::vector<uint8_t> data = {
+        0x19, 0x64, 0x0B, 0xB8,  // 25.00 C, 3.000 V
+        0x00, 0x00, 0xFF, 0xFF,  // -40.00 C, 65.535 V
+    };
+    
+    Decoder decoder(*schema_);
+    auto packet = decoder.decode(2, data);
+    REQUIRE(packet.ok());
+    REQUIRE(*packet.value().field("temperature")->fixed() == FixedPoint{2500, -2});
+    REQUIRE(*packet.value().field("voltage")->fixed() == FixedPoint{3000, -3});
+    
+    // Batches fill the integer columns only when asked
+    auto plain = decoder.decodeBatch(2, data, 4);
+    REQUIRE(plain.ok());
+    REQUIRE_FALSE(plain.value().column("temperature")->isFixed);
+    REQUIRE_FALSE(plain.value().column("temperature")->fixedAt(0));
+    
+    DecodeOptions opts;
+    opts.fixedPointScaling = true;
+    decoder.setOptions(opts);
+    auto batch = decoder.decodeBatch(2, data, 4);
+    REQUIRE(batch.ok());
+    
+    const auto* temperature = batch.value().column("temperature");
+    REQUIRE(temperature->isFixed);
+    REQUIRE(temperature->fixedExponent == -2);
+    REQUIRE(temperature->fixed == std::vector<int64_t>{2500, -4000});
+    REQUIRE(*temperature->fixedAt(1) == FixedPoint{-4000, -2});
+    
+    const auto* voltage = batch.value().column("voltage");
+    REQUIRE(voltage->fixed == std::vector<int64_t>{3000, 65535});
+    REQUIRE(voltage->fixedExponent == -3);
+    
+    // Back to raw exactly
+    REQUIRE(temperature->def->rawFromFixed(*temperature->fixedAt(0)) == 6500);
+    REQUIRE(temperature->def->rawFromFixed(*temperature->fixedAt(1)) == 0);
+}
+
+TEST_CASE("Decoder - fixed point uses the factors the schema resolved", "[decoder]") {
+    auto schema = SchemaBuilder()
+        .name("Resolved")
+        .bigEndian()
+        .packet(1, "Thermal")
+            .int16("temperature").scaled(0.01, -40.0)
+            .int16("ratio").scaled(1.0 / 3.0)
+        .build();
+    const auto& def = schema.findPacketById(1)->fields[0];
+    REQUIRE(def.fixedScaling == FixedScaling{1, -4000, -2});
+    REQUIRE_FALSE(schema.findPacketById(1)->fields[1].fixedScaling);
+    
+    // An equivalent form at another exponent shows which factors are read:
+    // neither path searches Scaling::fixed() again
+    const_cast<Field&>(def).fixedScaling = FixedScaling{10, -40000, -3};
+    
+    DecodeOptions opts;
+    opts.fixedPointScaling = true;
+    Decoder decoder(schema, opts);
+    std::vector<uint8_t> frame = {0x19, 0x64, 0x00, 0x03};
+    
+    auto packet = decoder.decode(1, frame);
+    REQUIRE(packet.ok());
+    REQUIRE(*packet.value().field("temperature")->fixed() == FixedPoint{25000, -3});
+    REQUIRE_FALSE(packet.value().field("ratio")->fixed());
+    
+    auto batch = decoder.decodeBatch(1, frame, frame.size());
+    REQUIRE(batch.ok());
+    REQUIRE(*batch.value().column("temperature")->fixedAt(0) == FixedPoint{25000, -3});
+    REQUIRE_FALSE(batch.value().column("ratio")->isFixed);
+    REQUIRE(def.rawFromFixed(FixedPoint{25, 0}) == 6500);
+}
+
+TEST_CASE("Decoder - fixed point outside int64", "[decoder]") {
+    auto schema = SchemaBuilder()
+        .name("Wide")
+        .bigEndian()
+        .packet(1, "Counters")
+            .uint64("plain")
+            .int64("doubled").scaled(2.0)
+            .int64("shifted").scaled(1.0, -1.0)
+            .uint64("ticks").scaled(10.0)
+        .build();
+    Decoder decoder(schema);
+    
+    const std::vector<uint8_t> outside = {
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // INT64_MAX + 1
+        0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 2^62, doubled
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // INT64_MIN, minus one
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // INT64_MAX + 1, times ten
+    };
+    auto packet = decoder.decode(1, outside);
+    REQUIRE(packet.ok());
+    REQUIRE_FALSE(packet.value().field("plain")->fixed());
+    REQUIRE_FALSE(packet.value().field("doubled")->fixed());
+    REQUIRE_FALSE(packet.value().field("shifted")->fixed());
+    REQUIRE_FALSE(packet.value().field("ticks")->fixed());
+    
+    // One below each limit still fits
+    const std::vector<uint8_t> inside = {
+        0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x0C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,  // INT64_MAX / 10
+    };
+    packet = decoder.decode(1, inside);
+    REQUIRE(packet.ok());
+    constexpr auto max = std::numeric_limits<int64_t>::max();
+    constexpr auto min = std::numeric_limits<int64_t>::min();
+    REQUIRE(*packet.value().field("plain")->fixed() == FixedPoint{max, 0});
+    REQUIRE(*packet.value().field("doubled")->fixed() == FixedPoint{max - 1, 0});
+    REQUIRE(*packet.value().field("shifted")->fixed() == FixedPoint{min, 0});
+    REQUIRE(*packet.value().field("ticks")->fixed() == FixedPoint{max - 7, 0});
+    
+    // Batches agree: a row whose fixed form overflows is invalid
+    DecodeOptions opts;
+    opts.fixedPointScaling = true;
+    opts.stopOnError = false;
+    decoder.setOptions(opts);
+    std::vector<uint8_t> frames(inside);
+    frames.insert(frames.end(), outside.begin(), outside.end());
+    auto batch = decoder.decodeBatch(1, frames, inside.size());
+    REQUIRE(batch.ok());
+    REQUIRE(batch.value().isValid(0));
+    REQUIRE_FALSE(batch.value().isValid(1));
+    REQUIRE(*batch.value().column("doubled")->fixedAt(0) == FixedPoint{max - 1, 0});
+    REQUIRE(*batch.value().column("shifted")->fixedAt(0) == FixedPoint{min, 0});
+    REQUIRE(*batch.value().column("ticks")->fixedAt(0) == FixedPoint{max - 7, 0});
+    REQUIRE(batch.value().column("ticks")->fixed[1] == 0);
+    
+    // Each overflowing column alone invalidates the row
+    for (std::size_t at : {8u, 16u, 24u}) {
+        std::vector<uint8_t> frame(inside);
+        std::copy_n(outside.begin() + at, 8, frame.begin() + at);
+        auto one = decoder.decodeBatch(1, frame, frame.size());
+        REQUIRE(one.ok());
+        REQUIRE_FALSE(one.value().isValid(0));
+    }
+    
+    opts.stopOnError = true;
+    decoder.setOptions(opts);
+    REQUIRE_FALSE(decoder.decodeBatch(1, frames, inside.size()).ok());
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - projection decodes selected fields only", "[decoder]") {
+    Decoder decoder(*schema_);
+    
+    auto projection = decoder.project(4, {"u32", "i8", "f64"});
+    REQUIRE(projection.ok());
+    REQUIRE(projection.value().fields().size() == 3);
+    
+    std::vector<uint8_t> data = {
+        0xFF,
+        0xFF, 0xFE,
+        0xFF, 0xFF, 0xFF, 0xFD,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+        0x01,
+        0x00, 0x02,
+        0x00, 0x00, 0x00, 0x03,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+        0x40, 0x48, 0xF5, 0xC3,
+        0x40, 0x09, 0x21, 0xFB, 0x54, 0x44, 0x2D, 0x18
+    };
+    
+    auto result = decoder.decode(projection.value(), data);
+    REQUIRE(result.ok());
+    
+    auto& packet = result.value();
+    REQUIRE(packet.fieldCount() == 3);
+    REQUIRE(packet.fieldAt(0)->name() == "i8");
+    REQUIRE(*packet.get<int64_t>("i8") == -1);
+    REQUIRE(*packet.get<uint64_t>("u32") == 3);
+    REQUIRE_THAT(*packet.get<double>("f64"), Catch::Matchers::WithinAbs(3.14159265358979, 0.0000001));
+    REQUIRE_FALSE(packet.hasField("i16"));
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - projection errors", "[decoder]") {
+    Decoder decoder(*schema_);
+    
+    REQUIRE(decoder.project(1, {"counter", "bogus"}).hasError());
+    REQUIRE(decoder.project(999, {"counter"}).hasError());
+    
+    auto projection = decoder.project(1, {"value"});
+    REQUIRE(projection.ok());
+    
+    std::vector<uint8_t> shortData = {0x00, 0x01};
+    REQUIRE(decoder.decode(projection.value(), shortData).hasError());
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - access by field handle", "[decoder]") {
+    Decoder decoder(*schema_);
+    
+    auto temperature = schema_->fieldHandle(2, "temperature");
+    auto voltage = schema_->fieldHandle("ScaledPacket", "voltage");
+    auto counter = schema_->fieldHandle(1, "counter");
+    REQUIRE(temperature.has_value());
+    REQUIRE(voltage.has_value());
+    REQUIRE(voltage->index == 1);
+    REQUIRE_FALSE(schema_->fieldHandle(2, "missing").has_value());
+    
+    std::vector<uint8_t> data = {0x19, 0x64, 0x0C, 0xE4};
+    
+    auto result = decoder.decode(2, data);
+    REQUIRE(result.ok());
+    auto& packet = result.value();
+    
+    REQUIRE_THAT(*packet.get<double>(*temperature), Catch::Matchers::WithinAbs(25.0, 0.001));
+    REQUIRE(packet.field(*voltage)->name() == "voltage");
+    REQUIRE(packet.hasField(*voltage));
+    REQUIRE_FALSE(packet.hasField(*counter));  // handle for another packet
+    
+    auto view = decoder.view(2, data);
+    REQUIRE_THAT(*view.value().get<double>(*voltage), Catch::Matchers::WithinAbs(3.3, 0.001));
+    
+    // Projected packets only resolve the handles that were decoded
+    auto projection = decoder.project({*voltage});
+    REQUIRE(projection.ok());
+    auto projected = decoder.decode(projection.value(), data);
+    REQUIRE(projected.ok());
+    REQUIRE(projected.value().field(*temperature) == nullptr);
+    REQUIRE(projected.value().field(*voltage) != nullptr);
+    
+    REQUIRE(decoder.project({*voltage, *counter}).hasError());
+}
+
+TEST_CASE("Decoder - packets added to the schema after construction", "[decoder]") {
+    Schema schema;
+    Packet first;
+    first.id = 1;
+    first.name = "First";
+    first.fields.push_back(Field{.name = "x", .type = DataType::UInt8});
+    schema.addPacket(first);
+    
+    Decoder decoder(schema);
+    auto projection = decoder.project(1, {"x"});
+    REQUIRE(projection.ok());
+    
+    // Enough packets to move any storage that grows by reallocating
+    for (uint32_t id = 2; id < 40; ++id) {
+        Packet packet;
+        packet.id = id;
+        packet.name = "Packet" + std::to_string(id);
+        packet.fields.push_back(Field{.name = "y", .type = DataType::UInt16});
+        schema.addPacket(std::move(packet));
+    }
+    
+    std::vector<uint8_t> frame = {0x05, 0x06};
+    auto decoded = decoder.decode(1, frame);
+    REQUIRE(decoded.ok());
+    REQUIRE(*decoded.value().get<uint64_t>("x") == 5);
+    
+    auto added = decoder.decode(39, frame);
+    REQUIRE(added.ok());
+    REQUIRE(*added.value().get<uint64_t>("y") == 0x0506);
+    REQUIRE(decoder.compiled().find(39) != nullptr);
+    
+    // Projections taken before the change still decode
+    auto projected = decoder.decode(projection.value(), frame);
+    REQUIRE(projected.ok());
+    REQUIRE(*projected.value().get<uint64_t>("x") == 5);
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - decodeInto reuses packet storage", "[decoder]") {
+    Decoder decoder(*schema_);
+    DecodedPacket packet;
+    
+    std::vector<uint8_t> first = {0x83, 0x05};
+    REQUIRE(decoder.decodeInto(3, first, packet) == DecodeStatus::Ok);
+    REQUIRE(packet.name() == "BitfieldPacket");
+    REQUIRE(*packet.get<uint64_t>("mode") == 5);
+    
+    const auto* fieldsBefore = packet.fields().data();
+    
+    std::vector<uint8_t> second = {0x02, 0x09};
+    REQUIRE(decoder.decodeInto(3, second, packet) == DecodeStatus::Ok);
+    REQUIRE(packet.fields().data() == fieldsBefore);
+    REQUIRE(packet.fieldCount() == 2);
+    REQUIRE(*packet.get<uint64_t>("mode") == 9);
+    REQUIRE(packet.field("status")->bitfield()->isSet("error"));
+    REQUIRE_FALSE(packet.field("status")->bitfield()->isSet("active"));
+    
+    // Switching packet type relays the packet out
+    std::vector<uint8_t> label = {'H', 'I', 0, 0, 0, 0, 0, 0, 0x00, 0x2A};
+    REQUIRE(decoder.decodeInto(5, label, packet) == DecodeStatus::Ok);
+    REQUIRE(packet.id() == 5);
+    REQUIRE(*packet.get<uint64_t>("id") == 42);
+    
+    DecodeError error;
+    std::vector<uint8_t> shortData = {0x00};
+    REQUIRE(decoder.decodeInto(5, shortData, packet, &error) == DecodeStatus::Truncated);
+    REQUIRE(error.needed == 10);
+    REQUIRE(error.available == 1);
+    REQUIRE_FALSE(error.message().empty());
+}
+
+TEST_CASE_METHOD(DecoderFixture, "Decoder - decodeInto reports status codes", "[decoder]") {
+    DecodedPacket packet;
+    
+    SECTION("Unknown packet") {
+        Decoder decoder(*schema_);
+        std::vector<uint8_t> data = {0x00};
+        REQUIRE(decoder.decodeInto(99, data, packet) == DecodeStatus::UnknownPacket);
+    }
+    
+    SECTION("Constraint violation") {
+        Decoder decoder(*schema_);
+        std::vector<uint8_t> data = {0x7F, 0xFF, 0x00, 0x00};
+        DecodeError error;
+        REQUIRE(decoder.decodeInto(2, data, packet, &error) == DecodeStatus::AboveMaximum);
+        REQUIRE(error.packetId == 2);
+        REQUIRE(error.fieldIndex == 0);
+        REQUIRE(error.fieldName() == "temperature");
+        REQUIRE(error.byteOffset == 0);
+        REQUIRE_THAT(error.value, Catch::Matchers::WithinAbs(287.67, 0.001));
+        REQUIRE(error.limit == 85.0);
+        REQUIRE(error.message().find("above maximum") != std::string::npos);
+    }
+    
+    SECTION("Short frame with error collection keeps what fits") {
+        DecodeOptions options;
+        options.stopOnError = false;
+        Decoder decoder(*schema_, options);
+        
+        std::vector<uint8_t> data = {0x00, 0x00, 0x00, 0x07, 0x00};
+        REQUIRE(decoder.decodeInto(1, data, packet) == DecodeStatus::Ok);
+        REQUIRE(packet.fieldCount() == 1);
+        REQUIRE(*packet.get<uint64_t>("counter") == 7);
+    }
+}
+
+TEST_CASE("DecodeErrorCounts - classify failures", "[decoder]") {
+    DecodeErrorCounts counts;
+    DecodeError error;
+    error.code = DecodeStatus::Truncated;
+    
+    counts.record(error);
+    counts.record(error);
+    counts.record(DecodeStatus::AboveMaximum);
+    counts.record(DecodeStatus::Ok);
+    
+    REQUIRE(counts.count(DecodeStatus::Truncated) == 2);
+    REQUIRE(counts.count(DecodeStatus::AboveMaximum) == 1);
+    REQUIRE(counts.total() == 3);
+    
+    counts.reset();
+    REQUIRE(counts.total() == 0);
+}
+
+TEST_CASE_METHOD(DecoderFixture, "DecodeError - message formatted on demand", "[decoder]") {
+    DecodeError error;
+    error.code = DecodeStatus::Truncated;
+    error.packetId = 1;
+    error.packet = schema_->findPacketById(1);
+    error.fieldIndex = 1;
+    error.byteOffset = 4;
+    error.needed = 2;
+    error.available = 1;
+    
+    REQUIRE(error.fieldName() == "value");
+    REQUIRE(error.message() == "Failed to decode field 'value' at offset 4: truncated (need 2 bytes, have 1)");
+    
+    error.fieldIndex = DecodeError::kNoField;
+    error.needed = 6;
+    REQUIRE(error.message() == "Packet 'SimplePacket' needs 6 bytes, have 1");
+}
+
+TEST_CASE("PacketPool - acquire and release", "[decoder]") {
+    PacketPool pool(2);
+    REQUIRE(pool.available() == 2);
+    
+    DecodedPacket* raw = nullptr;
+    {
+        auto a = pool.acquire();
+        auto b = pool.acquire();
+        auto c = pool.acquire();  // Pool empty: allocates
+        REQUIRE(pool.available() == 0);
+        raw = a.get();
+    }
+    REQUIRE(pool.available() == 3);
+    
+    // Most recently released packet comes back first
+    auto again = pool.acquire();
+    REQUIRE(again.get() == raw);
+}
+
+TEST_CASE("Decoder - array elements from YAML are range checked", "[decoder][arrays]") {
+    auto result = SchemaLoader::fromYaml(R"(
+schema:
+  name: "Arrays"
+  byte_order: "little"
+packets:
+  - id: 1
+    name: "Block"
+    fields:
+      - name: "samples"
+        type: "uint8[4]"
+        max: 100
+      - name: "gains"
+        type: "int16"
+        size: 2
+        scale: 0.5
+)");
+    REQUIRE(result.ok());
+    const auto& fields = result.value().packets()[0].fields;
+    REQUIRE(fields[0].type == DataType::UInt8);
+    REQUIRE(fields[0].arraySize == 4u);
+    REQUIRE(fields[1].isArray());
+    
+    Decoder decoder(result.value());
+    DecodedPacket packet;
+    std::vector<uint8_t> ok = {1, 2, 3, 100, 0xFE, 0xFF, 0x04, 0x00};
+    REQUIRE(decoder.decodeInto(1, ok, packet) == DecodeStatus::Ok);
+    REQUIRE(*packet.get<UIntArray>("samples") == UIntArray{1, 2, 3, 100});
+    REQUIRE(std::ranges::equal(packet.field("samples")->elements<uint8_t>(), std::vector<uint8_t>{1, 2, 3, 100}));
+    REQUIRE(std::ranges::equal(packet.field("gains")->elements<int16_t>(), std::vector<int16_t>{-2, 4}));
+    REQUIRE(*packet.get<RealArray>("gains") == RealArray{-1.0, 2.0});
+    
+    std::vector<uint8_t> bad = {1, 2, 101, 3, 0, 0, 0, 0};
+    DecodeError error;
+    REQUIRE(decoder.decodeInto(1, bad, packet, &error) == DecodeStatus::AboveMaximum);
+    REQUIRE(error.fieldName() == "samples");
+    REQUIRE(error.value == 101.0);
+    REQUIRE(error.limit == 100.0);
+}
+
+TEST_CASE("Decoder - borrowed payloads reference the frame", "[decoder][borrow]") {
+    auto result = SchemaLoader::fromYaml(R"(
+schema:
+  name: "Payloads"
+  byte_order: "big"
+packets:
+  - id: 7
+    name: "Chunk"
+    fields:
+      - name: "file"
+        type: "string"
+        size: 4
+      - name: "data"
+        type: "bytes"
+        size: 3
+      - name: "seq"
+        type: "uint16"
+)");
+    REQUIRE(result.ok());
+    const auto& schema = result.value();
+    std::vector<uint8_t> frame = {'l', 'o', 'g', '1', 0xDE, 0xAD, 0xBE, 0x00, 0x09};
+    
+    DecodeOptions options;
+    options.borrowPayloads = true;
+    Decoder decoder(schema, options);
+    
+    auto requireBorrowed = [&](const DecodedField* file, const DecodedField* data) {
+        REQUIRE(std::holds_alternative<std::string_view>(file->rawValue()));
+        REQUIRE(file->text() == "log1");
+        REQUIRE(file->text().data() == reinterpret_cast<const char*>(frame.data()));
+        REQUIRE(std::holds_alternative<ByteView>(data->rawValue()));
+        REQUIRE(data->bytes().data() == frame.data() + 4);
+        REQUIRE(data->bytes().size() == 3);
+    };
+    
+    SECTION("Fixed layout") {
+        auto packet = decoder.decode(7, frame);
+        REQUIRE(packet.ok());
+        requireBorrowed(packet.value().field("file"), packet.value().field("data"));
+        
+        // Owned copies on request
+        REQUIRE(*packet.value().get<std::string>("file") == "log1");
+        REQUIRE(*packet.value().get<std::vector<uint8_t>>("data") == std::vector<uint8_t>{0xDE, 0xAD, 0xBE});
+        REQUIRE(*packet.value().get<std::string_view>("file") == "log1");
+        
+        DecodedPacket reused;
+        REQUIRE(decoder.decodeInto(7, frame, reused) == DecodeStatus::Ok);
+        REQUIRE(decoder.decodeInto(7, frame, reused) == DecodeStatus::Ok);
+        requireBorrowed(reused.field("file"), reused.field("data"));
+    }
+    
+    SECTION("Field by field") {
+        options.stopOnError = false;
+        Decoder collecting(schema, options);
+        auto packet = collecting.decode(7, std::span<const uint8_t>(frame).first(7));
+        REQUIRE(packet.ok());
+        requireBorrowed(packet.value().field("file"), packet.value().field("data"));
+        REQUIRE_FALSE(packet.value().hasField("seq"));
+    }
+    
+    SECTION("View") {
+        auto view = decoder.view(7, frame);
+        REQUIRE(view.ok());
+        REQUIRE(std::get<std::string_view>(view.value().raw("file")).data() ==
+                reinterpret_cast<const char*>(frame.data()));
+        REQUIRE(std::get<ByteView>(view.value().value("data")) == ByteView(frame.data() + 4, 3));
+        REQUIRE(*view.value().get<std::string>("file") == "log1");
+    }
+    
+    SECTION("Copies by default") {
+        Decoder copying(schema);
+        auto packet = copying.decode(7, frame);
+        REQUIRE(packet.ok());
+        const auto* file = packet.value().field("file");
+        REQUIRE(std::holds_alternative<std::string>(file->rawValue()));
+        REQUIRE(file->text() == "log1");
+        REQUIRE(file->text().data() != reinterpret_cast<const char*>(frame.data()));
+        REQUIRE(packet.value().field("data")->bytes().size() == 3);
+        REQUIRE_FALSE(file->hasScaling());
+    }
+}
+
+TEST_CASE("Decoder - variable-length fields", "[decoder][variable]") {
+    auto result = SchemaLoader::fromYaml(R"(
+schema:
+  name: "Variable"
+  byte_order: "big"
+packets:
+  - id: 9
+    name: "Report"
+    fields:
+      - name: "name_len"
+        type: "uint8"
+      - name: "name"
+        type: "string"
+        length_field: "name_len"
+      - name: "count"
+        type: "uint16"
+      - name: "samples"
+        type: "int16"
+        length_field: "count"
+        size: 4
+        scale: 0.5
+      - name: "crc"
+        type: "uint8"
+)");
+    REQUIRE(result.ok());
+    const auto& schema = result.value();
+    Decoder decoder(schema);
+    REQUIRE_FALSE(decoder.compiled().find(9)->isFixedSize());
+    
+    std::vector<uint8_t> frame = {
+        3, 'c', 'a', 'm',
+        0x00, 0x02, 0xFF, 0xFE, 0x00, 0x10,
+        0xA5
+    };
+    
+    DecodedPacket packet;
+    REQUIRE(decoder.decodeInto(9, frame, packet) == DecodeStatus::Ok);
+    REQUIRE(*packet.get<std::string>("name") == "cam");
+    REQUIRE(std::get<IntArray>(packet.field("samples")->rawValue()) == IntArray{-2, 16});
+    REQUIRE(std::ranges::equal(packet.field("samples")->elements<int16_t>(), std::vector<int16_t>{-2, 16}));
+    REQUIRE(*packet.get<RealArray>("samples") == RealArray{-1.0, 8.0});
+    REQUIRE(*packet.get<uint64_t>("crc") == 0xA5);
+    
+    SECTION("Empty payloads") {
+        std::vector<uint8_t> empty = {0, 0x00, 0x00, 0x5A};
+        auto decoded = decoder.decode(9, empty);
+        REQUIRE(decoded.ok());
+        REQUIRE(decoded.value().field("name")->text().empty());
+        REQUIRE(std::get<IntArray>(decoded.value().field("samples")->rawValue()).empty());
+        REQUIRE(*decoded.value().get<uint64_t>("crc") == 0x5A);
+    }
+    
+    SECTION("Length beyond the declared maximum") {
+        frame[5] = 5;
+        DecodeError error;
+        REQUIRE(decoder.decodeInto(9, frame, packet, &error) == DecodeStatus::InvalidLength);
+        REQUIRE(error.fieldName() == "samples");
+        REQUIRE(error.byteOffset == 6);
+        REQUIRE(error.needed == 10);
+        REQUIRE(error.message().find("invalid length") != std::string::npos);
+    }
+    
+    SECTION("Length past the end of the frame") {
+        frame[0] = 40;
+        DecodeError error;
+        REQUIRE(decoder.decodeInto(9, frame, packet, &error) == DecodeStatus::Truncated);
+        REQUIRE(error.fieldName() == "name");
+        REQUIRE(error.needed == 40);
+    }
+    
+    SECTION("Missing length field with error collection") {
+        DecodeOptions options;
+        options.stopOnError = false;
+        Decoder collecting(schema, options);
+        std::vector<uint8_t> cut = {3, 'c', 'a', 'm', 0x00};
+        auto decoded = collecting.decode(9, cut);
+        REQUIRE(decoded.ok());
+        REQUIRE(decoded.value().hasField("name"));
+        REQUIRE_FALSE(decoded.value().hasField("count"));
+        REQUIRE_FALSE(decoded.value().hasField("samples"));
+    }
 }
@@ -0,0 +1,239 @@
+#include <catch2/catch_test_macros.hpp>
+#include <ionet/core/Kernels.h>
+#include <ionet/core/ByteBuffer.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace ionet::core;
+
+namespace {
+
+// Sizes straddling every vector width and tail length
+const std::vector<std::size_t> COUNTS = {0, 1, 3, 4, 7, 8, 15, 16, 17, 33, 257, 300};
+
+} // anonymous namespace
+
+TEST_CASE("Kernels - active kernel set has a name", "[kernels]") {
+    std::string name = kernels::kernelSetName(kernels::activeKernelSet());
+    REQUIRE((name == "scalar" || name == "ssse3" || name == "avx2"));
+}
+
+TEST_CASE("Kernels - byte swap matches scalar", "[kernels]") {
+    for (std::size_t count : COUNTS) {
+        std::vector<uint8_t> src(count * 8);
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            src[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+
+        std::vector<uint8_t> dst(src.size());
+        kernels::byteSwap16(src.data(), dst.data(), count);
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(endian::load<uint16_t>(dst.data() + i * 2, ByteOrder::Native) ==
+                    endian::byteSwap(endian::load<uint16_t>(src.data() + i * 2, ByteOrder::Native)));
+        }
+
+        kernels::byteSwap32(src.data(), dst.data(), count);
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(endian::load<uint32_t>(dst.data() + i * 4, ByteOrder::Native) ==
+                    endian::byteSwap(endian::load<uint32_t>(src.data() + i * 4, ByteOrder::Native)));
+        }
+
+        // In place
+        dst = src;
+        kernels::byteSwap64(dst.data(), dst.data(), count);
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(endian::load<uint64_t>(dst.data() + i * 8, ByteOrder::Native) ==
+                    endian::byteSwap(endian::load<uint64_t>(src.data() + i * 8, ByteOrder::Native)));
+        }
+    }
+}
+
+TEST_CASE("Kernels - integer conversion both byte orders", "[kernels]") {
+    for (ByteOrder order : {ByteOrder::Big, ByteOrder::Little}) {
+        for (std::size_t count : COUNTS) {
+            ByteBufferWriter i16, u16, i32, u32;
+            for (std::size_t i = 0; i < count; ++i) {
+                int v = static_cast<int>(i * 2654435761u);
+                i16.writeInt16(static_cast<int16_t>(v), order);
+                u16.writeUInt16(static_cast<uint16_t>(v), order);
+                i32.writeInt32(static_cast<int32_t>(v), order);
+                u32.writeUInt32(static_cast<uint32_t>(v), order);
+            }
+
+            std::vector<int64_t> ints(count);
+            std::vector<uint64_t> uints(count);
+
+            kernels::toInt64(DataType::Int16, i16.data().data(), count, order, ints.data());
+            ByteBufferReader r16(i16.data());
+            for (std::size_t i = 0; i < count; ++i) {
+                REQUIRE(ints[i] == r16.readInt16(order));
+            }
+
+            kernels::toUInt64(DataType::UInt16, u16.data().data(), count, order, uints.data());
+            ByteBufferReader ru16(u16.data());
+            for (std::size_t i = 0; i < count; ++i) {
+                REQUIRE(uints[i] == ru16.readUInt16(order));
+            }
+
+            kernels::toInt64(DataType::Int32, i32.data().data(), count, order, ints.data());
+            ByteBufferReader r32(i32.data());
+            for (std::size_t i = 0; i < count; ++i) {
+                REQUIRE(ints[i] == r32.readInt32(order));
+            }
+
+            kernels::toUInt64(DataType::UInt32, u32.data().data(), count, order, uints.data());
+            ByteBufferReader ru32(u32.data());
+            for (std::size_t i = 0; i < count; ++i) {
+                REQUIRE(uints[i] == ru32.readUInt32(order));
+            }
+        }
+    }
+}
+
+TEST_CASE("Kernels - float conversion and scaling", "[kernels]") {
+    for (std::size_t count : COUNTS) {
+        ByteBufferWriter f32, f64;
+        for (std::size_t i = 0; i < count; ++i) {
+            f32.writeFloat32(static_cast<float>(i) * -0.25f, ByteOrder::Big);
+            f64.writeFloat64(static_cast<double>(i) * 1.5, ByteOrder::Big);
+        }
+
+        std::vector<double> out(count);
+        kernels::toDouble(DataType::Float32, f32.data().data(), count, ByteOrder::Big, out.data());
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(out[i] == static_cast<double>(static_cast<float>(i) * -0.25f));
+        }
+
+        kernels::toDouble(DataType::Float64, f64.data().data(), count, ByteOrder::Big, out.data());
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(out[i] == static_cast<double>(i) * 1.5);
+        }
+
+        std::vector<double> scaled(count);
+        kernels::scale(out.data(), count, 0.5, -2.0, scaled.data());
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(scaled[i] == (out[i] * 0.5) - 2.0);
+        }
+
+        std::vector<int64_t> ints(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            ints[i] = static_cast<int64_t>(i) - 100;
+        }
+        kernels::scale(ints.data(), count, 0.01, -40.0, scaled.data());
+        for (std::size_t i = 0; i < count; ++i) {
+            REQUIRE(scaled[i] == (static_cast<double>(ints[i]) * 0.01) - 40.0);
+        }
+    }
+}
+
+TEST_CASE("Kernels - packed integers scale without widening", "[kernels]") {
+    const DataType types[] = {
+        DataType::Int8, DataType::UInt8, DataType::Int16, DataType::UInt16,
+        DataType::Int32, DataType::UInt32, DataType::Int64, DataType::Float32
+    };
+    for (ByteOrder order : {ByteOrder::Big, ByteOrder::Little}) {
+        for (std::size_t count : COUNTS) {
+            for (DataType type : types) {
+                // Pseudo-random bytes, with the extremes of each width up front
+                const std::size_t width = dataTypeSize(type);
+                std::vector<uint8_t> src(count * width);
+                for (std::size_t i = 0; i < src.size(); ++i) {
+                    src[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+                }
+                if (count > 1 && type != DataType::Float32) {
+                    std::fill_n(src.begin(), width, uint8_t{0xFF});
+                    std::fill_n(src.begin() + width, width, uint8_t{0x00});
+                    src[width + (order == ByteOrder::Big ? 0 : width - 1)] = 0x80;
+                }
+
+                // Same arithmetic as widening first, bit for bit
+                std::vector<double> expected(count);
+                if (type == DataType::Float32) {
+                    kernels::toDouble(type, src.data(), count, order, expected.data());
+                    kernels::scale(expected.data(), count, 0.01, -40.0, expected.data());
+                } else if (isSigned(type)) {
+                    std::vector<int64_t> wide(count);
+                    kernels::toInt64(type, src.data(), count, order, wide.data());
+                    kernels::scale(wide.data(), count, 0.01, -40.0, expected.data());
+                } else {
+                    std::vector<uint64_t> wide(count);
+                    kernels::toUInt64(type, src.data(), count, order, wide.data());
+                    kernels::scale(wide.data(), count, 0.01, -40.0, expected.data());
+                }
+
+                std::vector<double> out(count);
+                kernels::toScaled(type, src.data(), count, order, 0.01, -40.0, out.data());
+                // Compared as bits: random float bytes include NaNs
+                REQUIRE((count == 0 || std::memcmp(out.data(), expected.data(), count * sizeof(double)) == 0));
+            }
+        }
+    }
+}
+
+TEST_CASE("Kernels - sync search matches scalar", "[kernels]") {
+    const uint8_t pattern[] = {0x1A, 0xCF, 0xFC, 0x1D};
+
+    for (std::size_t length = 1; length <= 4; ++length) {
+        for (std::size_t size : {0, 1, 5, 31, 32, 33, 64, 100, 300}) {
+            // Noise full of near misses: first and last bytes without the middle
+            std::vector<uint8_t> data(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                data[i] = (i % 3 == 0) ? pattern[0] : pattern[length - 1];
+            }
+            for (std::size_t at = 0; at <= size; at += 7) {
+                auto copy = data;
+                for (std::size_t k = 0; k < length && at + k < size; ++k) {
+                    copy[at + k] = pattern[k];
+                }
+
+                // Reference: first full match or cut-off prefix
+                std::size_t expected = size;
+                for (std::size_t i = 0; i < size; ++i) {
+                    std::size_t avail = std::min(length, size - i);
+                    if (std::equal(pattern, pattern + avail, copy.begin() + static_cast<std::ptrdiff_t>(i))) {
+                        expected = i;
+                        break;
+                    }
+                }
+                REQUIRE(kernels::findSync(copy.data(), size, pattern, length) == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("Kernels - bit extraction matches reference", "[kernels]") {
+    // Contiguous runs, scattered bits and the edge cases 0 and all-ones
+    std::vector<uint64_t> masks = {
+        0, ~uint64_t{0}, 0x1, 0x8000000000000000ull, 0x1C, 0xF0F0, 0xFFFF0000,
+        0x8000000000000001ull, 0xAAAAAAAAAAAAAAAAull, 0x00FF00000000FF00ull,
+    };
+    for (unsigned bit = 0; bit < 64; bit += 5) {
+        for (unsigned width = 1; bit + width <= 64; width += 7) {
+            uint64_t run = width == 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+            masks.push_back(run << bit);
+        }
+    }
+
+    for (uint64_t value : {uint64_t{0}, ~uint64_t{0}, uint64_t{0x0123456789ABCDEF}, uint64_t{0xDEADBEEFCAFEF00D}}) {
+        std::vector<uint64_t> out(masks.size());
+        kernels::extractBits(value, masks.data(), masks.size(), out.data());
+
+        for (std::size_t i = 0; i < masks.size(); ++i) {
+            uint64_t expected = 0;
+            unsigned k = 0;
+            for (unsigned b = 0; b < 64; ++b) {
+                if ((masks[i] >> b) & 1) {
+                    expected |= ((value >> b) & 1) << k++;
+                }
+            }
+            REQUIRE(out[i] == expected);
+        }
+
+        // In place: masks are overwritten by the results
+        auto inPlace = masks;
+        kernels::extractBits(value, inPlace.data(), inPlace.size(), inPlace.data());
+        REQUIRE(inPlace == out);
+    }
+}
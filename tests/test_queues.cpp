@@ -0,0 +1,153 @@
+#include <catch2/catch_test_macros.hpp>
+#include <ionet/core/SpscQueue.h>
+#include <ionet/core/MpscQueue.h>
+#include <ionet/core/FrameSlab.h>
+#include <thread>
+#include <vector>
+
+using namespace ionet::core;
+
+TEST_CASE("SpscQueue - bounded push and pop", "[queues]") {
+    SpscQueue<int> queue(3);
+    REQUIRE(queue.capacity() == 4);
+    REQUIRE(queue.front() == nullptr);
+
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(queue.tryPush(i));
+    }
+    REQUIRE_FALSE(queue.tryPush(99));
+    REQUIRE(queue.size() == 4);
+
+    REQUIRE(*queue.front() == 0);
+    queue.pop();
+    REQUIRE(queue.tryPush(4));
+
+    for (int i = 1; i <= 4; ++i) {
+        REQUIRE(*queue.front() == i);
+        queue.pop();
+    }
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("SpscQueue - slots keep their storage", "[queues]") {
+    SpscQueue<std::vector<uint8_t>> queue(1);
+    REQUIRE(queue.tryPush([](std::vector<uint8_t>& slot) { slot.assign(64, 1); }));
+    const auto* storage = queue.front()->data();
+    queue.pop();
+
+    REQUIRE(queue.tryPush([](std::vector<uint8_t>& slot) { slot.assign(32, 2); }));
+    REQUIRE(queue.front()->data() == storage);
+}
+
+TEST_CASE("SpscQueue - producer and consumer threads", "[queues]") {
+    constexpr uint64_t count = 200000;
+    SpscQueue<uint64_t> queue(64);
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < count; ++i) {
+            while (!queue.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t expected = 0;
+    while (expected < count) {
+        if (auto* value = queue.front()) {
+            REQUIRE(*value == expected);
+            queue.pop();
+            ++expected;
+        }
+    }
+    producer.join();
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("MpscQueue - bounded push and pop", "[queues]") {
+    MpscQueue<int> queue(2);
+    REQUIRE(queue.front() == nullptr);
+    REQUIRE(queue.tryPush(1));
+    REQUIRE(queue.tryPush(2));
+    REQUIRE_FALSE(queue.tryPush(3));
+
+    REQUIRE(*queue.front() == 1);
+    queue.pop();
+    REQUIRE(queue.tryPush(3));
+    REQUIRE(*queue.front() == 2);
+    queue.pop();
+    REQUIRE(*queue.front() == 3);
+    queue.pop();
+    REQUIRE(queue.front() == nullptr);
+}
+
+TEST_CASE("FrameSlab - write, read and release with wrap", "[queues]") {
+    FrameSlab slab(1, 10);
+    std::vector<uint8_t> a = {1, 2, 3, 4};
+    std::vector<uint8_t> b = {5, 6, 7, 8, 9};
+
+    auto first = slab.write(0, a, 7);
+    auto second = slab.write(0, b);
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(first->tag == 7);
+    REQUIRE_FALSE(slab.write(0, a));   // Would straddle the end, and the start is in use
+
+    slab.release(*first);
+    auto third = slab.write(0, a);     // Skips the 1-byte tail, lands at the start
+    REQUIRE(third);
+    REQUIRE(third->position == 10);
+
+    auto bytes = slab.read(*third);
+    REQUIRE(std::vector<uint8_t>(bytes.begin(), bytes.end()) == a);
+    REQUIRE(std::vector<uint8_t>(slab.read(*second).begin(), slab.read(*second).end()) == b);
+
+    slab.release(*second);
+    slab.release(*third);
+    REQUIRE(slab.used(0) == 0);
+    REQUIRE_FALSE(slab.write(0, std::vector<uint8_t>(11)));
+}
+
+TEST_CASE("FrameSlab - producers hand frames to one consumer", "[queues]") {
+    constexpr uint32_t producers = 3;
+    constexpr uint32_t perProducer = 20000;
+    FrameSlab slab(producers, 256);
+    MpscQueue<FrameDescriptor> queue(64);
+
+    std::vector<std::thread> threads;
+    for (uint32_t lane = 0; lane < producers; ++lane) {
+        threads.emplace_back([&, lane] {
+            for (uint32_t seq = 0; seq < perProducer; ++seq) {
+                // Variable-length frames: the sequence number repeated
+                std::vector<uint8_t> frame(1 + seq % 13, static_cast<uint8_t>(seq));
+                std::optional<FrameDescriptor> descriptor;
+                while (!(descriptor = slab.write(lane, frame, seq))) {
+                    std::this_thread::yield();
+                }
+                while (!queue.tryPush(*descriptor)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint32_t> next(producers, 0);
+    for (uint32_t received = 0; received < producers * perProducer;) {
+        auto* descriptor = queue.front();
+        if (!descriptor) {
+            continue;
+        }
+        // Per-producer order survives the shared queue
+        REQUIRE(descriptor->tag == next[descriptor->lane]++);
+        auto bytes = slab.read(*descriptor);
+        REQUIRE(bytes.size() == 1 + descriptor->tag % 13);
+        REQUIRE(bytes.back() == static_cast<uint8_t>(descriptor->tag));
+
+        slab.release(*descriptor);
+        queue.pop();
+        ++received;
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
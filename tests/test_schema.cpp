@@ -2,6 +2,7 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <ionet/schema/Schema.h>
 #include <ionet/schema/SchemaBuilder.h>
+#include <limits>
 
 using namespace ionet::schema;
 using namespace ionet::core;
@@ -21,6 +22,98 @@ TEST_CASE("Field - scaling", "[schema]") {
     REQUIRE_THAT(s.apply(6000), Catch::Matchers::WithinAbs(20.0, 0.001));
 }
 
+TEST_CASE("Field - fixed-point scaling", "[schema]") {
+    Scaling s{0.01, -40.0};
+    auto fixed = s.fixed();
+    REQUIRE(fixed);
+    REQUIRE(fixed->multiplier == 1);
+    REQUIRE(fixed->bias == -4000);
+    REQUIRE(fixed->exponent == -2);
+    REQUIRE(*fixed->apply(6500) == FixedPoint{2500, -2});
+    REQUIRE(fixed->apply(6500)->toDouble() == 25.0);
+    
+    // Round trips are exact, also through other exponents and the double form
+    for (int64_t raw : {-32768, -1, 0, 1, 6500, 32767}) {
+        REQUIRE(s.remove(*fixed->apply(raw)) == raw);
+        REQUIRE(s.remove(s.apply(raw)) == raw);
+    }
+    REQUIRE(s.remove(FixedPoint{25, 0}) == 6500);
+    REQUIRE(s.remove(FixedPoint{250000, -4}) == 6500);
+    
+    REQUIRE(Scaling{0.5, 0.0}.fixed() == FixedScaling{5, 0, -1});
+    REQUIRE(Scaling{4.0, 10.0}.fixed() == FixedScaling{4, 10, 0});
+    REQUIRE_FALSE(Scaling{1.0 / 3.0, 0.0}.fixed());
+    REQUIRE_FALSE(Scaling{0.0, 1.0}.fixed());
+    
+    // Copies taken from a schema follow later edits to scale and offset
+    auto schema = SchemaBuilder()
+        .name("Thermal")
+        .packet(1, "Thermal")
+            .int16("temperature").scaled(0.01, -40.0)
+        .build();
+    REQUIRE(schema.findPacketById(1)->fields[0].scaling->fixed() == fixed);
+    REQUIRE(schema.findPacketById(1)->fields[0].fixedScaling == fixed);
+    REQUIRE(schema.findPacketById(1)->fields[0].rawFromFixed(FixedPoint{25, 0}) == 6500);
+    auto copy = *schema.findPacketById(1)->fields[0].scaling;
+    copy.scale = 0.1;
+    REQUIRE(copy.fixed() == FixedScaling{1, -400, -1});
+    REQUIRE(copy.remove(FixedPoint{25, 0}) == 650);
+    REQUIRE(Scaling{.scale = 0.5}.fixed() == FixedScaling{5, 0, -1});
+    REQUIRE(schema.findPacketById(1)->fields[0].scaling->remove(FixedPoint{25, 0}) == 6500);
+}
+
+TEST_CASE("Field - fixed-point scaling at the int64 limits", "[schema]") {
+    constexpr auto max = std::numeric_limits<int64_t>::max();
+    constexpr auto min = std::numeric_limits<int64_t>::min();
+    
+    FixedScaling identity{1, 0, 0};
+    REQUIRE(*identity.apply(max) == FixedPoint{max, 0});
+    REQUIRE(*identity.apply(min) == FixedPoint{min, 0});
+    REQUIRE(*identity.remove(FixedPoint{max, 0}) == max);
+    REQUIRE(*identity.remove(FixedPoint{min, 0}) == min);
+    
+    FixedScaling offset{1, -4000, -2};
+    REQUIRE(*offset.apply(min + 4000) == FixedPoint{min, -2});
+    REQUIRE_FALSE(offset.apply(min + 3999));
+    REQUIRE(*offset.apply(max) == FixedPoint{max - 4000, -2});
+    REQUIRE_FALSE(offset.remove(FixedPoint{max, -2}));
+    
+    FixedScaling twice{2, 0, 0};
+    REQUIRE(*twice.apply(max / 2) == FixedPoint{max - 1, 0});
+    REQUIRE_FALSE(twice.apply(max / 2 + 1));
+    REQUIRE(*twice.apply(min / 2) == FixedPoint{min, 0});
+    REQUIRE_FALSE(twice.apply(min / 2 - 1));
+    
+    FixedScaling negate{-1, 0, 0};
+    REQUIRE(*negate.apply(max) == FixedPoint{-max, 0});
+    REQUIRE_FALSE(negate.apply(min));
+    REQUIRE_FALSE(negate.remove(FixedPoint{min, 0}));
+    
+    // Moving to a finer exponent multiplies the mantissa
+    FixedScaling tenths{5, 0, -1};
+    REQUIRE_FALSE(tenths.remove(FixedPoint{max, 0}));
+    REQUIRE(*tenths.remove(FixedPoint{max / 10, 0}) == max / 10 * 2);
+    
+    // rawRange() ends exactly where apply() starts to overflow
+    REQUIRE(offset.rawRange() == std::pair{min + 4000, max});
+    REQUIRE(twice.rawRange() == std::pair{min / 2, max / 2});
+    REQUIRE(negate.rawRange() == std::pair{-max, max});
+    for (FixedScaling scaling : {identity, offset, twice, negate, tenths,
+                                 FixedScaling{-3, 5, 0}, FixedScaling{7, max, 0}, FixedScaling{-1, min, 0},
+                                 FixedScaling{-1, max, 0}, FixedScaling{-10, -7, 0}, FixedScaling{max, min, 0}}) {
+        auto [low, high] = scaling.rawRange();
+        REQUIRE(low <= 0);
+        REQUIRE(high >= 0);
+        REQUIRE(scaling.apply(low));
+        REQUIRE(scaling.apply(high));
+        REQUIRE((low == min || !scaling.apply(low - 1)));
+        REQUIRE((high == max || !scaling.apply(high + 1)));
+    }
+    
+    // Scaling::remove falls back to the double form on overflow
+    REQUIRE(Scaling{0.5, 0.0}.remove(FixedPoint{int64_t{1} << 60, 0}) == int64_t{1} << 61);
+}
+
 TEST_CASE("Packet - total size", "[schema]") {
     Packet p;
     p.fields.push_back(Field{.name = "a", .type = DataType::UInt8});
@@ -57,4 +150,45 @@ TEST_CASE("SchemaBuilder - fluent API", "[schema]") {
     
     REQUIRE(schema.info().name == "RocketTelemetry");
     REQUIRE(schema.packetCount() == 1);
-}
\ No newline at end of file
+}
+TEST_CASE("Schema - names are interned once", "[schema]") {
+    auto schema = SchemaBuilder()
+        .name("Power")
+        .packet(0x01, "Bus")
+            .uint16("voltage").unit("volts")
+            .uint16("reference").unit("volts")
+            .uint16("current").unit("amps")
+        .build();
+    
+    const auto* names = schema.packetNames(0x01);
+    REQUIRE(names != nullptr);
+    REQUIRE(names->packet == "Bus");
+    REQUIRE(names->find("current") == 2);
+    REQUIRE(names->find("missing") == -1);
+    REQUIRE(schema.packetNames(0x02) == nullptr);
+    
+    // Only names are interned; units stay on the fields
+    REQUIRE(schema.strings().find("voltage").has_value());
+    REQUIRE_FALSE(schema.strings().find("volts").has_value());
+    REQUIRE(schema.strings().size() == 4);
+    
+    // Adding packets leaves earlier names in place for decoded packets
+    for (uint32_t id = 0x10; id < 0x40; ++id) {
+        Packet packet;
+        packet.id = id;
+        packet.name = "Extra" + std::to_string(id);
+        schema.addPacket(std::move(packet));
+    }
+    REQUIRE(schema.packetNames(0x01) == names);
+    REQUIRE(names->find("current") == 2);
+    
+    // Moves keep the views; copies intern their own
+    auto moved = std::move(schema);
+    REQUIRE(moved.packetNames(0x01) == names);
+    REQUIRE(moved.packetNames(0x01)->find("reference") == 1);
+    
+    Schema copy = moved;
+    REQUIRE(copy.packetNames(0x01)->packet == "Bus");
+    REQUIRE(copy.packetNames(0x01)->packet.data() != names->packet.data());
+    REQUIRE(copy.packetNames(0x01)->find("voltage") == 0);
+}
@@ -173,6 +173,69 @@ packets:
     REQUIRE(status->bitFlags[0].description == "First flag");
 }
 
+TEST_CASE("SchemaLoader - bitfield subfields", "[schema_loader]") {
+    const char* subfieldSchema = R"(
+packets:
+  - id: 1
+    name: "SubfieldTest"
+    fields:
+      - name: "status"
+        type: "bitfield"
+        bits: 16
+        flags:
+          - { bit: 0, name: "armed" }
+        subfields:
+          - name: "mode"
+            bit: 1
+            width: 3
+            enum:
+              - { value: 0, name: "safe" }
+              - { value: 5, name: "burn" }
+          - { name: "gain", bit: 8, width: 4, scale: 0.5, offset: 1.0, unit: "dB" }
+)";
+    
+    auto result = SchemaLoader::fromYaml(subfieldSchema);
+    REQUIRE(result.ok());
+    
+    auto* status = result.value().findPacketById(1)->findField("status");
+    REQUIRE(status->subfields.size() == 2);
+    
+    const auto& mode = status->subfields[0];
+    REQUIRE(mode.name == "mode");
+    REQUIRE(mode.bit == 1);
+    REQUIRE(mode.width == 3);
+    REQUIRE(mode.mask() == 0x0E);
+    REQUIRE(mode.labels.size() == 2);
+    REQUIRE(*mode.label(5) == "burn");
+    REQUIRE(mode.label(3) == nullptr);
+    REQUIRE_FALSE(mode.scaling.has_value());
+    
+    const auto& gain = status->subfields[1];
+    REQUIRE(gain.mask() == 0x0F00);
+    REQUIRE(gain.scaling->scale == 0.5);
+    REQUIRE(gain.scaling->offset == 1.0);
+    REQUIRE(gain.unit == "dB");
+    REQUIRE(status->subfieldIndex("gain") == 1);
+}
+
+TEST_CASE("SchemaLoader - subfield outside its bitfield", "[schema_loader]") {
+    const char* overflowSchema = R"(
+packets:
+  - id: 1
+    name: "Overflow"
+    fields:
+      - name: "status"
+        type: "bitfield"
+        bits: 8
+        subfields:
+          - { name: "mode", bit: 6, width: 3 }
+)";
+    
+    auto result = SchemaLoader::fromYaml(overflowSchema);
+    REQUIRE(result.hasError());
+    REQUIRE(result.error().message.find("Subfield 'mode'") != std::string::npos);
+}
+
 TEST_CASE("SchemaLoader - field constraints", "[schema_loader]") {
     const char* constraintSchema = R"(
 packets:
@@ -213,4 +276,65 @@ TEST_CASE("FileSource - non-existent file", "[schema_source]") {
     
     auto result = source.read();
     REQUIRE(result.hasError());
-}
\ No newline at end of file
+}
+TEST_CASE("SchemaLoader - bit-packed integer fields", "[schema_loader]") {
+    const char* packedSchema = R"(
+packets:
+  - id: 1
+    name: "Packed"
+    fields:
+      - { name: "adc0", type: "uint16", bits: 12 }
+      - { name: "adc1", type: "int16", bits: 12 }
+      - { name: "tag", type: "uint8", bits: 4, bit_offset: 28 }
+)";
+    
+    auto result = SchemaLoader::fromYaml(packedSchema);
+    REQUIRE(result.ok());
+    
+    const auto* packet = result.value().findPacketById(1);
+    REQUIRE(packet->findField("adc0")->isBitPacked());
+    REQUIRE(packet->findField("adc1")->bitCount == 12);
+    REQUIRE_FALSE(packet->findField("adc1")->bitOffset.has_value());
+    REQUIRE(packet->findField("tag")->bitOffset == 28u);
+    
+    const char* tooWide = R"(
+packets:
+  - id: 1
+    name: "Packed"
+    fields:
+      - { name: "adc0", type: "uint8", bits: 12 }
+)";
+    auto bad = SchemaLoader::fromYaml(tooWide);
+    REQUIRE(bad.hasError());
+    REQUIRE(bad.error().message.find("cannot pack 12 bits into uint8") != std::string::npos);
+}
+
+TEST_CASE("SchemaLoader - variable-length fields", "[schema_loader]") {
+    const char* varSchema = R"(
+packets:
+  - id: 1
+    name: "Chunk"
+    fields:
+      - { name: "len", type: "uint8" }
+      - { name: "data", type: "bytes", length_field: "len", size: 200 }
+)";
+    
+    auto result = SchemaLoader::fromYaml(varSchema);
+    REQUIRE(result.ok());
+    const auto* packet = result.value().findPacketById(1);
+    REQUIRE(packet->findField("data")->lengthField == "len");
+    REQUIRE(packet->findField("data")->arraySize == 200u);
+    REQUIRE_FALSE(packet->isFixedSize());
+    
+    const char* laterLength = R"(
+packets:
+  - id: 1
+    name: "Chunk"
+    fields:
+      - { name: "data", type: "bytes", length_field: "len" }
+      - { name: "len", type: "uint8" }
+)";
+    auto bad = SchemaLoader::fromYaml(laterLength);
+    REQUIRE(bad.hasError());
+    REQUIRE(bad.error().message.find("not an earlier integer field") != std::string::npos);
+}
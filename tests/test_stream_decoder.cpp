@@ -0,0 +1,205 @@
+#include <catch2/catch_test_macros.hpp>
+#include <../include/ionet/codec/StreamDecoder.h>
+#include <../include/ionet/schema/SchemaLoader.h>
+#include <../include/ionet/schema/SchemaBuilder.h>
+
+using namespace ionet::codec;
+using namespace ionet::schema;
+using namespace ionet::core;
+
+const char* STREAM_SCHEMA = R"(
+schema:
+  name: "StreamSchema"
+  byte_order: "big"
+  frame:
+    sync: [0xEB, 0x90]
+    id: { offset: 2, type: "uint8" }
+    length: { offset: 3, type: "uint16" }
+
+packets:
+  - id: 1
+    name: "Ping"
+    fields:
+      - name: "seq"
+        type: "uint16"
+
+  - id: 2
+    name: "Reading"
+    fields:
+      - name: "value"
+        type: "int16"
+        max: 100
+      - name: "channel"
+        type: "uint8"
+)";
+
+class StreamFixture {
+protected:
+    StreamFixture() {
+        auto result = SchemaLoader::fromYaml(STREAM_SCHEMA);
+        REQUIRE(result.ok());
+        schema_ = std::make_unique<Schema>(std::move(result.value()));
+        decoder_ = std::make_unique<Decoder>(*schema_);
+    }
+
+    /// Build a framed ping
+    static std::vector<uint8_t> ping(uint16_t seq) {
+        return {0xEB, 0x90, 0x01, 0x00, 0x02,
+                static_cast<uint8_t>(seq >> 8), static_cast<uint8_t>(seq)};
+    }
+
+    std::unique_ptr<Schema> schema_;
+    std::unique_ptr<Decoder> decoder_;
+};
+
+TEST_CASE_METHOD(StreamFixture, "StreamDecoder - frame header parsed from YAML", "[stream]") {
+    const auto& header = schema_->frameHeader();
+    REQUIRE(header.has_value());
+    REQUIRE(header->sync == std::vector<uint8_t>{0xEB, 0x90});
+    REQUIRE(header->id.offset == 2);
+    REQUIRE(header->length->type == DataType::UInt16);
+    REQUIRE(header->size == 5);
+}
+
+TEST_CASE("StreamDecoder - sync values must be bytes", "[stream]") {
+    auto yaml = SchemaLoader::fromYaml(R"(
+schema:
+  name: "Wide"
+  frame:
+    sync: [0x1ACF]
+    id: { offset: 2 }
+packets:
+  - id: 1
+    name: "Ping"
+    fields:
+      - name: "seq"
+        type: "uint8"
+)");
+    REQUIRE(yaml.hasError());
+    REQUIRE(yaml.error().message.find("sync") != std::string::npos);
+    
+    auto json = SchemaLoader::fromJson(R"({
+        "schema": {"name": "Wide", "frame": {"sync": [235, 256], "id": {"offset": 2}}},
+        "packets": [{"id": 1, "name": "Ping", "fields": [{"name": "seq", "type": "uint8"}]}]
+    })");
+    REQUIRE(json.hasError());
+    REQUIRE(json.error().message.find("256") != std::string::npos);
+    
+    auto negative = SchemaLoader::fromJson(R"({
+        "schema": {"name": "Wide", "frame": {"sync": [-1], "id": {"offset": 2}}},
+        "packets": [{"id": 1, "name": "Ping", "fields": [{"name": "seq", "type": "uint8"}]}]
+    })");
+    REQUIRE(negative.hasError());
+}
+
+TEST_CASE_METHOD(StreamFixture, "StreamDecoder - frames split across chunks", "[stream]") {
+    std::vector<uint16_t> seqs;
+    StreamDecoder stream(*decoder_, [&](const DecodedPacket& packet) {
+        seqs.push_back(static_cast<uint16_t>(*packet.get<uint64_t>("seq")));
+    });
+
+    std::vector<uint8_t> data;
+    for (uint16_t seq = 1; seq <= 5; ++seq) {
+        auto frame = ping(seq);
+        data.insert(data.end(), frame.begin(), frame.end());
+    }
+
+    SECTION("One chunk") {
+        REQUIRE(stream.feed(data) == 5);
+    }
+
+    SECTION("Byte at a time") {
+        for (uint8_t byte : data) {
+            stream.feed(std::span<const uint8_t>(&byte, 1));
+        }
+    }
+
+    SECTION("Uneven chunks") {
+        std::span<const uint8_t> rest(data);
+        std::size_t sizes[] = {3, 9, 1, 13, 100};
+        for (std::size_t size : sizes) {
+            std::size_t n = std::min(size, rest.size());
+            stream.feed(rest.first(n));
+            rest = rest.subspan(n);
+        }
+    }
+
+    REQUIRE(seqs == std::vector<uint16_t>{1, 2, 3, 4, 5});
+    REQUIRE(stream.buffered() == 0);
+    REQUIRE(stream.stats().framesDecoded == 5);
+    REQUIRE(stream.stats().bytesSkipped == 0);
+}
+
+TEST_CASE_METHOD(StreamFixture, "StreamDecoder - resynchronizes after noise", "[stream]") {
+    std::vector<uint16_t> seqs;
+    StreamDecoder stream(*decoder_, [&](const DecodedPacket& packet) {
+        seqs.push_back(static_cast<uint16_t>(*packet.get<uint64_t>("seq")));
+    });
+    std::vector<DecodeStatus> errors;
+    stream.setErrorCallback([&](const DecodeError& error) { errors.push_back(error.code); });
+
+    std::vector<uint8_t> data = {0x00, 0xEB, 0x11};               // Noise with a false sync start
+    auto first = ping(7);
+    data.insert(data.end(), first.begin(), first.end());
+    data.insert(data.end(), {0xEB, 0x90, 0x09, 0x00, 0x02});      // Unknown packet ID
+    auto second = ping(8);
+    data.insert(data.end(), second.begin(), second.end());
+
+    stream.feed(data);
+
+    REQUIRE(seqs == std::vector<uint16_t>{7, 8});
+    REQUIRE(stream.stats().bytesSkipped == 8);
+    REQUIRE(stream.stats().errors.count(DecodeStatus::UnknownPacket) == 1);
+    REQUIRE(errors == std::vector<DecodeStatus>{DecodeStatus::UnknownPacket});
+}
+
+TEST_CASE_METHOD(StreamFixture, "StreamDecoder - bad length inside a buffered frame", "[stream]") {
+    std::vector<uint16_t> seqs;
+    StreamDecoder stream(*decoder_, [&](const DecodedPacket& packet) {
+        seqs.push_back(static_cast<uint16_t>(*packet.get<uint64_t>("seq")));
+    });
+    stream.setMaxPayloadSize(16);
+
+    // Header claims a huge payload; the real frame hides behind it
+    std::vector<uint8_t> bogus = {0xEB, 0x90, 0x01, 0xFF};
+    stream.feed(bogus);
+    REQUIRE(stream.buffered() == 4);
+
+    auto frame = ping(3);
+    std::vector<uint8_t> rest = {0xFF};
+    rest.insert(rest.end(), frame.begin(), frame.end());
+    stream.feed(rest);
+
+    REQUIRE(seqs == std::vector<uint16_t>{3});
+    REQUIRE(stream.buffered() == 0);
+    REQUIRE(stream.stats().errors.count(DecodeStatus::InvalidLength) == 1);
+}
+
+TEST_CASE_METHOD(StreamFixture, "StreamDecoder - failed decode consumes the frame", "[stream]") {
+    std::size_t packets = 0;
+    StreamDecoder stream(*decoder_, [&](const DecodedPacket&) { ++packets; });
+
+    // value = 200 violates max: 100
+    std::vector<uint8_t> data = {0xEB, 0x90, 0x02, 0x00, 0x03, 0x00, 0xC8, 0x01};
+    auto frame = ping(1);
+    data.insert(data.end(), frame.begin(), frame.end());
+
+    REQUIRE(stream.feed(data) == 1);
+    REQUIRE(packets == 1);
+    REQUIRE(stream.stats().errors.count(DecodeStatus::AboveMaximum) == 1);
+    REQUIRE(stream.stats().bytesSkipped == 0);
+}
+
+TEST_CASE("StreamDecoder - requires a frame header", "[stream]") {
+    auto schema = SchemaBuilder().packet(1, "P").uint8("x").build();
+    Decoder decoder(schema);
+    REQUIRE_THROWS_AS(StreamDecoder(decoder, nullptr), std::invalid_argument);
+
+    FrameHeader header;
+    header.id = HeaderField{0, DataType::UInt8};
+    header.size = 1;
+    StreamDecoder stream(decoder, header, nullptr);
+
+    std::vector<uint8_t> data = {0x01, 0x2A, 0x01, 0x07};
+    REQUIRE(stream.feed(data) == 2);
+}
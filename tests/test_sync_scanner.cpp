@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+#include <ionet/core/SyncScanner.h>
+#include <vector>
+
+using namespace ionet::core;
+
+TEST_CASE("SyncScanner - finds pattern and partial tail", "[sync]") {
+    const std::vector<uint8_t> sync = {0xEB, 0x90};
+    SyncScanner scanner(sync);
+
+    std::vector<uint8_t> data(100, 0xEB);
+    data[60] = 0xEB;
+    data[61] = 0x90;
+    REQUIRE(scanner.find(data) == 60);
+    REQUIRE(scanner.find(data, 61) == 99);  // Cut-off 0xEB at the end
+    REQUIRE(scanner.find(data, 100) == 100);
+}
+
+TEST_CASE("SyncScanner - resync advances a reader and counts skips", "[sync]") {
+    const std::vector<uint8_t> sync = {0x1A, 0xCF, 0xFC, 0x1D};
+    SyncScanner scanner(sync);
+
+    std::vector<uint8_t> data = {0x00, 0x1A, 0xCF, 0x11, 0x1A, 0xCF, 0xFC, 0x1D, 0x42, 0x1A, 0xCF};
+    ByteBufferReader reader(data);
+
+    REQUIRE(scanner.resync(reader));
+    REQUIRE(reader.position() == 4);
+    REQUIRE(scanner.bytesSkipped() == 4);
+
+    // Already aligned: nothing skipped
+    REQUIRE(scanner.resync(reader));
+    REQUIRE(scanner.resyncs() == 1);
+
+    reader.skip(5);
+    REQUIRE_FALSE(scanner.resync(reader));
+    REQUIRE(reader.position() == 9);
+    REQUIRE(scanner.bytesSkipped() == 4);
+    REQUIRE(scanner.resyncs() == 1);
+}
+
+TEST_CASE("SyncScanner - rejects bad patterns", "[sync]") {
+    std::vector<uint8_t> empty;
+    std::vector<uint8_t> tooLong(5, 0xAA);
+    REQUIRE_THROWS_AS(SyncScanner(empty), std::invalid_argument);
+    REQUIRE_THROWS_AS(SyncScanner(tooLong), std::invalid_argument);
+}